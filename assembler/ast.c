@@ -14,6 +14,8 @@ void Fy_AST_Delete(Fy_AST *ast) {
     case Fy_ASTType_Number:
     case Fy_ASTType_Bx:
     case Fy_ASTType_Bp:
+    case Fy_ASTType_Si:
+    case Fy_ASTType_Di:
         break;
     case Fy_ASTType_Variable:
         free(ast->as_variable);
@@ -72,6 +74,12 @@ static Fy_AST *Fy_ASTParser_parseLiteralExpr(Fy_ASTParser *ast_parser) {
         case Fy_TokenType_Bp:
             expr = Fy_AST_New(Fy_ASTType_Bp);
             break;
+        case Fy_TokenType_Si:
+            expr = Fy_AST_New(Fy_ASTType_Si);
+            break;
+        case Fy_TokenType_Di:
+            expr = Fy_AST_New(Fy_ASTType_Di);
+            break;
         default:
             Fy_Parser_loadState(parser, &backtrack);
         }
@@ -204,6 +212,8 @@ Fy_AST *Fy_Parser_parseMemExpr(Fy_Parser *parser, Fy_InstructionArgType *out) {
         type = Fy_InstructionArgType_Memory8;
     else if (Fy_Parser_match(parser, Fy_TokenType_Word, true))
         type = Fy_InstructionArgType_Memory16;
+    else if (Fy_Parser_match(parser, Fy_TokenType_Dword, true))
+        type = Fy_InstructionArgType_Memory32;
     else
         type = Fy_InstructionArgType_MemoryUnknownSize;
 
@@ -267,6 +277,8 @@ void Fy_AST_eval(Fy_AST *ast, Fy_Parser *parser, Fy_InlineValue *out) {
         out->numeric = ast->as_number;
         out->times_bp = 0;
         out->times_bx = 0;
+        out->times_si = 0;
+        out->times_di = 0;
         break;
     case Fy_ASTType_Variable: {
         Fy_BucketNode *entry = Fy_Symbolmap_getEntry(&parser->symmap, ast->as_variable);
@@ -279,6 +291,8 @@ void Fy_AST_eval(Fy_AST *ast, Fy_Parser *parser, Fy_InlineValue *out) {
         out->numeric = 0;
         out->times_bx = 0;
         out->times_bp = 0;
+        out->times_si = 0;
+        out->times_di = 0;
         break;
     }
     case Fy_ASTType_Bx:
@@ -286,12 +300,32 @@ void Fy_AST_eval(Fy_AST *ast, Fy_Parser *parser, Fy_InlineValue *out) {
         out->numeric = 0;
         out->times_bx = 1;
         out->times_bp = 0;
+        out->times_si = 0;
+        out->times_di = 0;
         break;
     case Fy_ASTType_Bp:
         out->has_variable = false;
         out->numeric = 0;
         out->times_bx = 0;
         out->times_bp = 1;
+        out->times_si = 0;
+        out->times_di = 0;
+        break;
+    case Fy_ASTType_Si:
+        out->has_variable = false;
+        out->numeric = 0;
+        out->times_bx = 0;
+        out->times_bp = 0;
+        out->times_si = 1;
+        out->times_di = 0;
+        break;
+    case Fy_ASTType_Di:
+        out->has_variable = false;
+        out->numeric = 0;
+        out->times_bx = 0;
+        out->times_bp = 0;
+        out->times_si = 0;
+        out->times_di = 1;
         break;
     case Fy_ASTType_Add: {
         Fy_InlineValue lhs;
@@ -312,6 +346,8 @@ void Fy_AST_eval(Fy_AST *ast, Fy_Parser *parser, Fy_InlineValue *out) {
         out->numeric = lhs.numeric + rhs.numeric;
         out->times_bx = lhs.times_bx + rhs.times_bx;
         out->times_bp = lhs.times_bp + rhs.times_bp;
+        out->times_si = lhs.times_si + rhs.times_si;
+        out->times_di = lhs.times_di + rhs.times_di;
         break;
     }
     case Fy_ASTType_Sub: {
@@ -330,6 +366,8 @@ void Fy_AST_eval(Fy_AST *ast, Fy_Parser *parser, Fy_InlineValue *out) {
         out->numeric = lhs.numeric - rhs.numeric;
         out->times_bx = lhs.times_bx - rhs.times_bx;
         out->times_bp = lhs.times_bp - rhs.times_bp;
+        out->times_si = lhs.times_si - rhs.times_si;
+        out->times_di = lhs.times_di - rhs.times_di;
         break;
     }
     case Fy_ASTType_Mul: {
@@ -347,6 +385,8 @@ void Fy_AST_eval(Fy_AST *ast, Fy_Parser *parser, Fy_InlineValue *out) {
             out->numeric = multiplier * rhs.numeric;
             out->times_bp = multiplier * rhs.times_bp;
             out->times_bx = multiplier * rhs.times_bx;
+            out->times_si = multiplier * rhs.times_si;
+            out->times_di = multiplier * rhs.times_di;
         } else if (Fy_InlineValue_isFullyNumeric(&rhs)) {
             if (lhs.has_variable)
                 Fy_Parser_error(parser, Fy_ParserError_InvalidOperation, &ast->lhs->state, "Variables in addresses cannot be multiplied");
@@ -354,6 +394,8 @@ void Fy_AST_eval(Fy_AST *ast, Fy_Parser *parser, Fy_InlineValue *out) {
             out->numeric = multiplier * lhs.numeric;
             out->times_bp = multiplier * lhs.times_bp;
             out->times_bx = multiplier * lhs.times_bx;
+            out->times_si = multiplier * lhs.times_si;
+            out->times_di = multiplier * lhs.times_di;
         } else {
             Fy_Parser_error(parser, Fy_ParserError_InvalidOperation, &ast->state, NULL);
         }
@@ -380,6 +422,8 @@ void Fy_AST_eval(Fy_AST *ast, Fy_Parser *parser, Fy_InlineValue *out) {
         out->numeric = lhs.numeric / divider;
         out->times_bp = lhs.times_bp / divider;
         out->times_bx = lhs.times_bx / divider;
+        out->times_si = lhs.times_si / divider;
+        out->times_di = lhs.times_di / divider;
         break;
     }
     case Fy_ASTType_Neg: {
@@ -391,6 +435,8 @@ void Fy_AST_eval(Fy_AST *ast, Fy_Parser *parser, Fy_InlineValue *out) {
         out->numeric = -value.numeric;
         out->times_bp = -value.times_bp;
         out->times_bx = -value.times_bx;
+        out->times_si = -value.times_si;
+        out->times_di = -value.times_di;
         break;
     }
     default:
@@ -399,7 +445,8 @@ void Fy_AST_eval(Fy_AST *ast, Fy_Parser *parser, Fy_InlineValue *out) {
 }
 
 static inline bool Fy_InlineValue_isFullyNumeric(Fy_InlineValue *inline_value) {
-    return !inline_value->has_variable && !inline_value->times_bp && !inline_value->times_bx;
+    return !inline_value->has_variable && !inline_value->times_bp && !inline_value->times_bx
+           && !inline_value->times_si && !inline_value->times_di;
 }
 
 uint16_t Fy_InlineValue_getMapping(Fy_InlineValue *inline_value, uint8_t *mapping) {
@@ -421,6 +468,14 @@ uint16_t Fy_InlineValue_getMapping(Fy_InlineValue *inline_value, uint8_t *mappin
         map |= FY_INLINEVAL_MAPPING_HASBX;
         size += 2;
     }
+    if (inline_value->times_si) {
+        map |= FY_INLINEVAL_MAPPING_HASSI;
+        size += 2;
+    }
+    if (inline_value->times_di) {
+        map |= FY_INLINEVAL_MAPPING_HASDI;
+        size += 2;
+    }
     if (mapping)
         *mapping = map;
     return size;
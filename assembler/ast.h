@@ -15,12 +15,16 @@ typedef struct Fy_InlineValue Fy_InlineValue;
 #define FY_INLINEVAL_MAPPING_HASBP (1 << 1)
 #define FY_INLINEVAL_MAPPING_HASBX (1 << 2)
 #define FY_INLINEVAL_MAPPING_HASNUM (1 << 3)
+#define FY_INLINEVAL_MAPPING_HASSI (1 << 4)
+#define FY_INLINEVAL_MAPPING_HASDI (1 << 5)
 
 typedef enum Fy_ASTType {
     Fy_ASTType_Number = 1,
     Fy_ASTType_Variable,
     Fy_ASTType_Bx,
     Fy_ASTType_Bp,
+    Fy_ASTType_Si,
+    Fy_ASTType_Di,
     Fy_ASTType_Add,
     Fy_ASTType_Sub,
     Fy_ASTType_Mul,
@@ -58,6 +62,8 @@ struct Fy_InlineValue {
     int16_t numeric;
     int16_t times_bx;
     int16_t times_bp;
+    int16_t times_si;
+    int16_t times_di;
 };
 
 Fy_AST *Fy_Parser_parseMemExpr(Fy_Parser *parser, Fy_InstructionArgType *out);
@@ -51,6 +51,10 @@ void Fy_Generator_addMemory(Fy_Generator *generator, Fy_InlineValue *mem) {
         Fy_Generator_addWord(generator, mem->times_bp);
     if (mapping & FY_INLINEVAL_MAPPING_HASBX)
         Fy_Generator_addWord(generator, mem->times_bx);
+    if (mapping & FY_INLINEVAL_MAPPING_HASSI)
+        Fy_Generator_addWord(generator, mem->times_si);
+    if (mapping & FY_INLINEVAL_MAPPING_HASDI)
+        Fy_Generator_addWord(generator, mem->times_di);
     if (mapping & FY_INLINEVAL_MAPPING_HASNUM)
         Fy_Generator_addWord(generator, mem->numeric);
 }
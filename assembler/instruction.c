@@ -7,6 +7,24 @@ Fy_Instruction *Fy_Instruction_New(const Fy_InstructionType *type, size_t size)
     return instruction;
 }
 
+static void Fy_Instruction_BinaryOperator3_Delete(Fy_Instruction_BinaryOperator3 *instruction) {
+    switch (instruction->type) {
+    case Fy_BinaryOperator3ArgsType_Reg16Reg16Reg16:
+    case Fy_BinaryOperator3ArgsType_Reg16Reg16Const:
+    case Fy_BinaryOperator3ArgsType_Reg8Reg8Reg8:
+    case Fy_BinaryOperator3ArgsType_Reg8Reg8Const:
+        break;
+    case Fy_BinaryOperator3ArgsType_Reg16Reg16Memory16:
+        Fy_AST_Delete(instruction->as_reg16reg16mem16.ast);
+        break;
+    case Fy_BinaryOperator3ArgsType_Reg8Reg8Memory8:
+        Fy_AST_Delete(instruction->as_reg8reg8mem8.ast);
+        break;
+    default:
+        FY_UNREACHABLE();
+    }
+}
+
 void Fy_Instruction_Delete(Fy_Instruction *instruction) {
     switch (instruction->parse_rule->type) {
     case Fy_ParserParseRuleType_Custom: {
@@ -17,6 +35,10 @@ void Fy_Instruction_Delete(Fy_Instruction *instruction) {
     }
     case Fy_ParserParseRuleType_BinaryOperator: {
         Fy_Instruction_BinaryOperator *binary_instruction = (Fy_Instruction_BinaryOperator*)instruction;
+        if (instruction->type == &Fy_instructionTypeBinaryOperator3) {
+            Fy_Instruction_BinaryOperator3_Delete((Fy_Instruction_BinaryOperator3*)instruction);
+            break;
+        }
         switch (binary_instruction->type) {
         case Fy_BinaryOperatorArgsType_Reg16Const:
         case Fy_BinaryOperatorArgsType_Reg16Reg16:
@@ -68,6 +90,26 @@ void Fy_Instruction_Delete(Fy_Instruction *instruction) {
         free(jump_instruction->name);
         break;
     }
+    case Fy_ParserParseRuleType_Operator32: {
+        Fy_Instruction_Operator32 *operator32_instruction = (Fy_Instruction_Operator32*)instruction;
+        if (operator32_instruction->type == Fy_Operator32ArgsType_Memory32)
+            Fy_AST_Delete(operator32_instruction->as_mem32.ast);
+        break;
+    }
+    case Fy_ParserParseRuleType_FpuOperator: {
+        Fy_Instruction_FpuOperator *fpu_instruction = (Fy_Instruction_FpuOperator*)instruction;
+        if (fpu_instruction->type == Fy_FpuArgsType_RegFloatMemory32 || fpu_instruction->type == Fy_FpuArgsType_Memory32RegFloat)
+            Fy_AST_Delete(fpu_instruction->as_mem32.ast);
+        break;
+    }
+    case Fy_ParserParseRuleType_Conditional: {
+        Fy_Instruction_Conditional *conditional_instruction = (Fy_Instruction_Conditional*)instruction;
+        if (conditional_instruction->type == Fy_ConditionalArgsType_Reg16Memory16)
+            Fy_AST_Delete(conditional_instruction->as_reg16mem16.ast);
+        else if (conditional_instruction->type == Fy_ConditionalArgsType_Memory8)
+            Fy_AST_Delete(conditional_instruction->as_mem8.ast);
+        break;
+    }
     default:
         FY_UNREACHABLE();
     }
@@ -77,6 +119,7 @@ void Fy_Instruction_Delete(Fy_Instruction *instruction) {
 /* Instruction type functions */
 static void Fy_instructionTypeDebug_run(Fy_VM *vm, uint16_t address) {
     (void)address;
+    Fy_Output_sync(&vm->output);
     printf("DEBUG INFO:\n");
     printf("AX: (h)%.2X (l)%.2X\n", vm->reg_ax[1], vm->reg_ax[0]);
     printf("BX: (h)%.2X (l)%.2X\n", vm->reg_bx[1], vm->reg_bx[0]);
@@ -85,6 +128,12 @@ static void Fy_instructionTypeDebug_run(Fy_VM *vm, uint16_t address) {
     printf("IP: %.4X\n", vm->reg_ip);
     printf("SP: %.4X\n", vm->reg_sp);
     printf("BP: %.4X\n", vm->reg_bp);
+    printf("SI: %.4X\n", vm->reg_si);
+    printf("DI: %.4X\n", vm->reg_di);
+    for (int i = 0; i < 8; ++i)
+        printf("R%d: %.4X\n", 8 + i, vm->reg_r[i]);
+    for (int i = 0; i < 8; ++i)
+        printf("F%d: %g\n", i, vm->reg_f[i]);
     printf("FLAG_ZERO: %d\n", vm->flags & FY_FLAGS_ZERO ? 1 : 0);
     printf("FLAG_SIGN: %d\n", vm->flags & FY_FLAGS_SIGN ? 1 : 0);
     printf("FLAG_CARRY: %d\n", vm->flags & FY_FLAGS_CARRY ? 1 : 0);
@@ -93,6 +142,7 @@ static void Fy_instructionTypeDebug_run(Fy_VM *vm, uint16_t address) {
 
 static void Fy_instructionTypeDebugStack_run(Fy_VM *vm, uint16_t address) {
     (void)address;
+    Fy_Output_sync(&vm->output);
     // if in range
     if (vm->reg_sp <= vm->stack_offset && vm->reg_sp >= (vm->stack_offset - vm->stack_size)) {
         printf("STACK INFO:\n");
@@ -125,8 +175,7 @@ static void Fy_instructionTypeJe_write(Fy_Generator *generator, Fy_Instruction_O
 }
 
 static void Fy_instructionTypeJe_run(Fy_VM *vm, uint16_t address) {
-    // If the zero flag is on
-    if (vm->flags & FY_FLAGS_ZERO)
+    if (Fy_VM_isConditionMet(vm, Fy_Condition_E))
         Fy_VM_setIpToRelAddress(vm, Fy_VM_getMem16(vm, address + 0));
 }
 
@@ -135,8 +184,7 @@ static void Fy_instructionTypeJne_write(Fy_Generator *generator, Fy_Instruction_
 }
 
 static void Fy_instructionTypeJne_run(Fy_VM *vm, uint16_t address) {
-    // If the zero flag is off
-    if (!(vm->flags & FY_FLAGS_ZERO))
+    if (Fy_VM_isConditionMet(vm, Fy_Condition_Ne))
         Fy_VM_setIpToRelAddress(vm, Fy_VM_getMem16(vm, address + 0));
 }
 
@@ -145,8 +193,7 @@ static void Fy_instructionTypeJb_write(Fy_Generator *generator, Fy_Instruction_O
 }
 
 static void Fy_instructionTypeJb_run(Fy_VM *vm, uint16_t address) {
-    // If the zero flag is off
-    if (vm->flags & FY_FLAGS_CARRY && !(vm->flags & FY_FLAGS_ZERO))
+    if (Fy_VM_isConditionMet(vm, Fy_Condition_B))
         Fy_VM_setIpToRelAddress(vm, Fy_VM_getMem16(vm, address + 0));
 }
 
@@ -155,8 +202,7 @@ static void Fy_instructionTypeJbe_write(Fy_Generator *generator, Fy_Instruction_
 }
 
 static void Fy_instructionTypeJbe_run(Fy_VM *vm, uint16_t address) {
-    // If the zero flag is off
-    if (vm->flags & FY_FLAGS_CARRY || (vm->flags & FY_FLAGS_ZERO))
+    if (Fy_VM_isConditionMet(vm, Fy_Condition_Be))
         Fy_VM_setIpToRelAddress(vm, Fy_VM_getMem16(vm, address + 0));
 }
 
@@ -165,8 +211,7 @@ static void Fy_instructionTypeJa_write(Fy_Generator *generator, Fy_Instruction_O
 }
 
 static void Fy_instructionTypeJa_run(Fy_VM *vm, uint16_t address) {
-    // If the zero flag is off
-    if (!(vm->flags & FY_FLAGS_CARRY) && !(vm->flags & FY_FLAGS_ZERO))
+    if (Fy_VM_isConditionMet(vm, Fy_Condition_A))
         Fy_VM_setIpToRelAddress(vm, Fy_VM_getMem16(vm, address + 0));
 }
 
@@ -175,8 +220,7 @@ static void Fy_instructionTypeJae_write(Fy_Generator *generator, Fy_Instruction_
 }
 
 static void Fy_instructionTypeJae_run(Fy_VM *vm, uint16_t address) {
-    // If the zero flag is off
-    if (!(vm->flags & FY_FLAGS_CARRY) || (vm->flags & FY_FLAGS_ZERO))
+    if (Fy_VM_isConditionMet(vm, Fy_Condition_Ae))
         Fy_VM_setIpToRelAddress(vm, Fy_VM_getMem16(vm, address + 0));
 }
 
@@ -185,8 +229,7 @@ static void Fy_instructionTypeJl_write(Fy_Generator *generator, Fy_Instruction_O
 }
 
 static void Fy_instructionTypeJl_run(Fy_VM *vm, uint16_t address) {
-    // If we have the sign it means the result was negative, thus the lhs was smaller than the rhs
-    if (!!(vm->flags & FY_FLAGS_SIGN) != !!(vm->flags & FY_FLAGS_OVERFLOW) && !(vm->flags & FY_FLAGS_ZERO))
+    if (Fy_VM_isConditionMet(vm, Fy_Condition_L))
         Fy_VM_setIpToRelAddress(vm, Fy_VM_getMem16(vm, address + 0));
 }
 
@@ -195,8 +238,7 @@ static void Fy_instructionTypeJle_write(Fy_Generator *generator, Fy_Instruction_
 }
 
 static void Fy_instructionTypeJle_run(Fy_VM *vm, uint16_t address) {
-    // If we have the sign it means the result was negative, thus the lhs was smaller than the rhs
-    if (!!(vm->flags & FY_FLAGS_SIGN) != !!(vm->flags & FY_FLAGS_OVERFLOW) || (vm->flags & FY_FLAGS_ZERO))
+    if (Fy_VM_isConditionMet(vm, Fy_Condition_Le))
         Fy_VM_setIpToRelAddress(vm, Fy_VM_getMem16(vm, address + 0));
 }
 
@@ -205,8 +247,7 @@ static void Fy_instructionTypeJg_write(Fy_Generator *generator, Fy_Instruction_O
 }
 
 static void Fy_instructionTypeJg_run(Fy_VM *vm, uint16_t address) {
-    // If we don't have the sign and don't equal 0 it means the result was positive, thus the lhs was bigger than than the rhs
-    if (!!(vm->flags & FY_FLAGS_SIGN) == !!(vm->flags & FY_FLAGS_OVERFLOW) && !(vm->flags & FY_FLAGS_ZERO))
+    if (Fy_VM_isConditionMet(vm, Fy_Condition_G))
         Fy_VM_setIpToRelAddress(vm, Fy_VM_getMem16(vm, address + 0));
 }
 
@@ -215,8 +256,46 @@ static void Fy_instructionTypeJge_write(Fy_Generator *generator, Fy_Instruction_
 }
 
 static void Fy_instructionTypeJge_run(Fy_VM *vm, uint16_t address) {
-    // If we don't have the sign and don't equal 0 it means the result was positive, thus the lhs was bigger than than the rhs
-    if (!!(vm->flags & FY_FLAGS_SIGN) == !!(vm->flags & FY_FLAGS_OVERFLOW) || (vm->flags & FY_FLAGS_ZERO))
+    if (Fy_VM_isConditionMet(vm, Fy_Condition_Ge))
+        Fy_VM_setIpToRelAddress(vm, Fy_VM_getMem16(vm, address + 0));
+}
+
+/* Decrements cx without touching the flags and returns whether it is still nonzero */
+static bool Fy_decrementLoopCounter(Fy_VM *vm) {
+    uint8_t flags = vm->flags;
+    uint16_t count;
+
+    Fy_VM_getReg16(vm, Fy_Reg16_Cx, &count);
+    --count;
+    Fy_VM_setReg16(vm, Fy_Reg16_Cx, count);
+    vm->flags = flags;
+    return count != 0;
+}
+
+static void Fy_instructionTypeLoop_write(Fy_Generator *generator, Fy_Instruction_OpLabel *instruction) {
+    Fy_Generator_addWord(generator, instruction->address);
+}
+
+static void Fy_instructionTypeLoop_run(Fy_VM *vm, uint16_t address) {
+    if (Fy_decrementLoopCounter(vm))
+        Fy_VM_setIpToRelAddress(vm, Fy_VM_getMem16(vm, address + 0));
+}
+
+static void Fy_instructionTypeLoopz_write(Fy_Generator *generator, Fy_Instruction_OpLabel *instruction) {
+    Fy_Generator_addWord(generator, instruction->address);
+}
+
+static void Fy_instructionTypeLoopz_run(Fy_VM *vm, uint16_t address) {
+    if (Fy_decrementLoopCounter(vm) && (vm->flags & FY_FLAGS_ZERO))
+        Fy_VM_setIpToRelAddress(vm, Fy_VM_getMem16(vm, address + 0));
+}
+
+static void Fy_instructionTypeLoopnz_write(Fy_Generator *generator, Fy_Instruction_OpLabel *instruction) {
+    Fy_Generator_addWord(generator, instruction->address);
+}
+
+static void Fy_instructionTypeLoopnz_run(Fy_VM *vm, uint16_t address) {
+    if (Fy_decrementLoopCounter(vm) && !(vm->flags & FY_FLAGS_ZERO))
         Fy_VM_setIpToRelAddress(vm, Fy_VM_getMem16(vm, address + 0));
 }
 
@@ -757,6 +836,172 @@ static void Fy_instructionTypeBinaryOperator_run(Fy_VM *vm, uint16_t address) {
     vm->reg_ip += instruction_size;
 }
 
+static uint16_t Fy_instructionTypeBinaryOperator3_getsize(Fy_Instruction_BinaryOperator3 *instruction) {
+    uint16_t size = 1 + 1; // The type and operator bytes
+
+    switch (instruction->type) {
+    case Fy_BinaryOperator3ArgsType_Reg16Reg16Reg16:
+        size += 1 + 1 + 1;
+        break;
+    case Fy_BinaryOperator3ArgsType_Reg16Reg16Const:
+        size += 1 + 1 + 2;
+        break;
+    case Fy_BinaryOperator3ArgsType_Reg16Reg16Memory16:
+        size += 1 + 1 + Fy_InlineValue_getMapping(&instruction->as_reg16reg16mem16.address, NULL);
+        break;
+    case Fy_BinaryOperator3ArgsType_Reg8Reg8Reg8:
+    case Fy_BinaryOperator3ArgsType_Reg8Reg8Const:
+        size += 1 + 1 + 1;
+        break;
+    case Fy_BinaryOperator3ArgsType_Reg8Reg8Memory8:
+        size += 1 + 1 + Fy_InlineValue_getMapping(&instruction->as_reg8reg8mem8.address, NULL);
+        break;
+    default:
+        FY_UNREACHABLE();
+    }
+
+    return size;
+}
+
+static void Fy_instructionTypeBinaryOperator3_write(Fy_Generator *generator, Fy_Instruction_BinaryOperator3 *instruction) {
+    Fy_Generator_addByte(generator, instruction->type);
+    Fy_Generator_addByte(generator, instruction->operator);
+    switch (instruction->type) {
+    case Fy_BinaryOperator3ArgsType_Reg16Reg16Reg16:
+        Fy_Generator_addByte(generator, instruction->as_reg16reg16reg16.reg_id);
+        Fy_Generator_addByte(generator, instruction->as_reg16reg16reg16.reg2_id);
+        Fy_Generator_addByte(generator, instruction->as_reg16reg16reg16.reg3_id);
+        break;
+    case Fy_BinaryOperator3ArgsType_Reg16Reg16Const:
+        Fy_Generator_addByte(generator, instruction->as_reg16reg16const.reg_id);
+        Fy_Generator_addByte(generator, instruction->as_reg16reg16const.reg2_id);
+        Fy_Generator_addWord(generator, instruction->as_reg16reg16const.value);
+        break;
+    case Fy_BinaryOperator3ArgsType_Reg16Reg16Memory16:
+        Fy_Generator_addByte(generator, instruction->as_reg16reg16mem16.reg_id);
+        Fy_Generator_addByte(generator, instruction->as_reg16reg16mem16.reg2_id);
+        Fy_Generator_addMemory(generator, &instruction->as_reg16reg16mem16.address);
+        break;
+    case Fy_BinaryOperator3ArgsType_Reg8Reg8Reg8:
+        Fy_Generator_addByte(generator, instruction->as_reg8reg8reg8.reg_id);
+        Fy_Generator_addByte(generator, instruction->as_reg8reg8reg8.reg2_id);
+        Fy_Generator_addByte(generator, instruction->as_reg8reg8reg8.reg3_id);
+        break;
+    case Fy_BinaryOperator3ArgsType_Reg8Reg8Const:
+        Fy_Generator_addByte(generator, instruction->as_reg8reg8const.reg_id);
+        Fy_Generator_addByte(generator, instruction->as_reg8reg8const.reg2_id);
+        Fy_Generator_addByte(generator, instruction->as_reg8reg8const.value);
+        break;
+    case Fy_BinaryOperator3ArgsType_Reg8Reg8Memory8:
+        Fy_Generator_addByte(generator, instruction->as_reg8reg8mem8.reg_id);
+        Fy_Generator_addByte(generator, instruction->as_reg8reg8mem8.reg2_id);
+        Fy_Generator_addMemory(generator, &instruction->as_reg8reg8mem8.address);
+        break;
+    default:
+        FY_UNREACHABLE();
+    }
+}
+
+static void Fy_instructionTypeBinaryOperator3_run(Fy_VM *vm, uint16_t address) {
+    uint8_t type = Fy_VM_getMem8(vm, address + 0);
+    uint8_t operator = Fy_VM_getMem8(vm, address + 1);
+    uint16_t instruction_size = 1 + 1 + 1; // How much we need to advance
+
+    switch (type) {
+    case Fy_BinaryOperator3ArgsType_Reg16Reg16Reg16: {
+        uint8_t reg_id = Fy_VM_getMem8(vm, address + 2);
+        uint8_t reg2_id = Fy_VM_getMem8(vm, address + 3);
+        uint8_t reg3_id = Fy_VM_getMem8(vm, address + 4);
+        uint16_t lhs, rhs;
+
+        if (!Fy_VM_getReg16(vm, reg2_id, &lhs) || !Fy_VM_getReg16(vm, reg3_id, &rhs))
+            return;
+
+        Fy_VM_runBinaryOperator3OnReg16(vm, operator, reg_id, lhs, rhs);
+        instruction_size += 1 + 1 + 1;
+        break;
+    }
+    case Fy_BinaryOperator3ArgsType_Reg16Reg16Const: {
+        uint8_t reg_id = Fy_VM_getMem8(vm, address + 2);
+        uint8_t reg2_id = Fy_VM_getMem8(vm, address + 3);
+        uint16_t rhs = Fy_VM_getMem16(vm, address + 4);
+        uint16_t lhs;
+
+        if (!Fy_VM_getReg16(vm, reg2_id, &lhs))
+            return;
+
+        Fy_VM_runBinaryOperator3OnReg16(vm, operator, reg_id, lhs, rhs);
+        instruction_size += 1 + 1 + 2;
+        break;
+    }
+    case Fy_BinaryOperator3ArgsType_Reg16Reg16Memory16: {
+        uint8_t reg_id = Fy_VM_getMem8(vm, address + 2);
+        uint8_t reg2_id = Fy_VM_getMem8(vm, address + 3);
+        uint16_t value_address;
+        uint16_t lhs, rhs;
+        uint16_t memory_param_size;
+
+        // Read the address before writing any register, since it might depend on bx
+        memory_param_size = Fy_VM_readMemoryParam(vm, address + 4, &value_address);
+        rhs = Fy_VM_getMem16(vm, value_address);
+        if (!Fy_VM_getReg16(vm, reg2_id, &lhs))
+            return;
+
+        Fy_VM_runBinaryOperator3OnReg16(vm, operator, reg_id, lhs, rhs);
+        instruction_size += 1 + 1 + memory_param_size;
+        break;
+    }
+    case Fy_BinaryOperator3ArgsType_Reg8Reg8Reg8: {
+        uint8_t reg_id = Fy_VM_getMem8(vm, address + 2);
+        uint8_t reg2_id = Fy_VM_getMem8(vm, address + 3);
+        uint8_t reg3_id = Fy_VM_getMem8(vm, address + 4);
+        uint8_t lhs, rhs;
+
+        if (!Fy_VM_getReg8(vm, reg2_id, &lhs) || !Fy_VM_getReg8(vm, reg3_id, &rhs))
+            return;
+
+        Fy_VM_runBinaryOperator3OnReg8(vm, operator, reg_id, lhs, rhs);
+        instruction_size += 1 + 1 + 1;
+        break;
+    }
+    case Fy_BinaryOperator3ArgsType_Reg8Reg8Const: {
+        uint8_t reg_id = Fy_VM_getMem8(vm, address + 2);
+        uint8_t reg2_id = Fy_VM_getMem8(vm, address + 3);
+        uint8_t rhs = Fy_VM_getMem8(vm, address + 4);
+        uint8_t lhs;
+
+        if (!Fy_VM_getReg8(vm, reg2_id, &lhs))
+            return;
+
+        Fy_VM_runBinaryOperator3OnReg8(vm, operator, reg_id, lhs, rhs);
+        instruction_size += 1 + 1 + 1;
+        break;
+    }
+    case Fy_BinaryOperator3ArgsType_Reg8Reg8Memory8: {
+        uint8_t reg_id = Fy_VM_getMem8(vm, address + 2);
+        uint8_t reg2_id = Fy_VM_getMem8(vm, address + 3);
+        uint16_t value_address;
+        uint8_t lhs, rhs;
+        uint16_t memory_param_size;
+
+        // Read the address before writing any register, since it might depend on bl or bh
+        memory_param_size = Fy_VM_readMemoryParam(vm, address + 4, &value_address);
+        rhs = Fy_VM_getMem8(vm, value_address);
+        if (!Fy_VM_getReg8(vm, reg2_id, &lhs))
+            return;
+
+        Fy_VM_runBinaryOperator3OnReg8(vm, operator, reg_id, lhs, rhs);
+        instruction_size += 1 + 1 + memory_param_size;
+        break;
+    }
+    default:
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_InvalidOpcode, "Three operand binary operator id '%d'", type);
+        return;
+    }
+
+    vm->reg_ip += instruction_size;
+}
+
 static uint16_t Fy_instructionTypeUnaryOperator_getsize(Fy_Instruction_UnaryOperator *instruction) {
     uint16_t size = 1;
 
@@ -845,6 +1090,423 @@ static void Fy_instructionTypeCbw_run(Fy_VM *vm, uint16_t address) {
     }
 }
 
+static void Fy_instructionTypeIret_run(Fy_VM *vm, uint16_t address) {
+    (void)address;
+    Fy_VM_returnFromInterrupt(vm);
+}
+
+static void Fy_instructionTypeLeaLabel_write(Fy_Generator *generator, Fy_Instruction_OpReg16Label *instruction) {
+    Fy_Generator_addByte(generator, instruction->reg_id);
+    Fy_Generator_addWord(generator, instruction->address);
+}
+
+static void Fy_instructionTypeLeaLabel_run(Fy_VM *vm, uint16_t address) {
+    uint8_t reg_id = Fy_VM_getMem8(vm, address + 0);
+    uint16_t rel_addr = Fy_VM_getMem16(vm, address + 1);
+    Fy_VM_setReg16(vm, reg_id, rel_addr);
+}
+
+/* Block instructions work on `cx` elements of `size` bytes, the source is at `bx` and the destination is at `dx` */
+
+/* Stores the registers after a block instruction without touching the flags */
+static void Fy_setBlockRegisters(Fy_VM *vm, uint16_t src, uint16_t dest, uint16_t count) {
+    uint8_t flags = vm->flags;
+    Fy_VM_setReg16(vm, Fy_Reg16_Bx, src);
+    Fy_VM_setReg16(vm, Fy_Reg16_Dx, dest);
+    Fy_VM_setReg16(vm, Fy_Reg16_Cx, count);
+    vm->flags = flags;
+}
+
+static void Fy_runBlockMove(Fy_VM *vm, uint8_t size) {
+    uint16_t src, dest, count;
+    uint32_t length;
+
+    Fy_VM_getReg16(vm, Fy_Reg16_Bx, &src);
+    Fy_VM_getReg16(vm, Fy_Reg16_Dx, &dest);
+    Fy_VM_getReg16(vm, Fy_Reg16_Cx, &count);
+    length = (uint32_t)count * size;
+
+    Fy_VM_copyMem(vm, dest, src, length);
+    Fy_setBlockRegisters(vm, src + length, dest + length, 0);
+}
+
+static void Fy_runBlockStore(Fy_VM *vm, uint8_t size) {
+    uint16_t src, dest, count, value;
+    uint32_t length;
+
+    Fy_VM_getReg16(vm, Fy_Reg16_Bx, &src);
+    Fy_VM_getReg16(vm, Fy_Reg16_Dx, &dest);
+    Fy_VM_getReg16(vm, Fy_Reg16_Cx, &count);
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &value);
+    length = (uint32_t)count * size;
+
+    if (size == 1)
+        Fy_VM_fillMem8(vm, dest, (uint8_t)value, count);
+    else
+        Fy_VM_fillMem16(vm, dest, value, count);
+    Fy_setBlockRegisters(vm, src, dest + length, 0);
+}
+
+/* Compares while the elements are equal and stops after the first mismatch, like x86 `repe cmps` */
+static void Fy_runBlockCompare(Fy_VM *vm, uint8_t size) {
+    uint16_t src, dest, count;
+    uint32_t mismatch, amount_compared, length;
+
+    Fy_VM_getReg16(vm, Fy_Reg16_Bx, &src);
+    Fy_VM_getReg16(vm, Fy_Reg16_Dx, &dest);
+    Fy_VM_getReg16(vm, Fy_Reg16_Cx, &count);
+    if (count == 0)
+        return;
+
+    mismatch = Fy_VM_compareMem(vm, src, dest, (uint32_t)count * size) / size;
+    // Flags come from the last compared pair, which is the mismatch if there is one
+    amount_compared = mismatch < count ? mismatch + 1 : count;
+    length = amount_compared * size;
+    Fy_setBlockRegisters(vm, src + length, dest + length, count - amount_compared);
+
+    src += length - size;
+    dest += length - size;
+    if (size == 1)
+        Fy_VM_compare8(vm, Fy_VM_getMem8(vm, src), Fy_VM_getMem8(vm, dest));
+    else
+        Fy_VM_compare16(vm, Fy_VM_getMem16(vm, src), Fy_VM_getMem16(vm, dest));
+}
+
+static void Fy_instructionTypeMovsb_run(Fy_VM *vm, uint16_t address) {
+    (void)address;
+    Fy_runBlockMove(vm, 1);
+}
+
+static void Fy_instructionTypeMovsw_run(Fy_VM *vm, uint16_t address) {
+    (void)address;
+    Fy_runBlockMove(vm, 2);
+}
+
+static void Fy_instructionTypeStosb_run(Fy_VM *vm, uint16_t address) {
+    (void)address;
+    Fy_runBlockStore(vm, 1);
+}
+
+static void Fy_instructionTypeStosw_run(Fy_VM *vm, uint16_t address) {
+    (void)address;
+    Fy_runBlockStore(vm, 2);
+}
+
+static void Fy_instructionTypeCmpsb_run(Fy_VM *vm, uint16_t address) {
+    (void)address;
+    Fy_runBlockCompare(vm, 1);
+}
+
+static void Fy_instructionTypeCmpsw_run(Fy_VM *vm, uint16_t address) {
+    (void)address;
+    Fy_runBlockCompare(vm, 2);
+}
+
+static uint16_t Fy_instructionTypeOperator32_getsize(Fy_Instruction_Operator32 *instruction) {
+    uint16_t size = 1; // Because we have one info byte
+
+    switch (instruction->type) {
+    case Fy_Operator32ArgsType_Const:
+        size += 2;
+        break;
+    case Fy_Operator32ArgsType_Reg16Reg16:
+        size += 1 + 1;
+        break;
+    case Fy_Operator32ArgsType_Memory32:
+        size += Fy_InlineValue_getMapping(&instruction->as_mem32.address, NULL);
+        break;
+    default:
+        FY_UNREACHABLE();
+    }
+
+    return size;
+}
+
+static void Fy_instructionTypeOperator32_write(Fy_Generator *generator, Fy_Instruction_Operator32 *instruction) {
+    Fy_Generator_addByte(generator, (instruction->type << 4) + instruction->operator);
+    switch (instruction->type) {
+    case Fy_Operator32ArgsType_Const:
+        Fy_Generator_addWord(generator, instruction->as_const);
+        break;
+    case Fy_Operator32ArgsType_Reg16Reg16:
+        Fy_Generator_addByte(generator, instruction->as_reg16reg16.high_reg_id);
+        Fy_Generator_addByte(generator, instruction->as_reg16reg16.low_reg_id);
+        break;
+    case Fy_Operator32ArgsType_Memory32:
+        Fy_Generator_addMemory(generator, &instruction->as_mem32.address);
+        break;
+    default:
+        FY_UNREACHABLE();
+    }
+}
+
+static void Fy_instructionTypeOperator32_run(Fy_VM *vm, uint16_t address) {
+    uint8_t info_byte = Fy_VM_getMem8(vm, address + 0);
+    uint8_t type = info_byte >> 4;
+    uint8_t operator = info_byte & 0x0f;
+    uint16_t instruction_size = 1 + 1; // How much we need to advance
+    uint32_t value;
+
+    switch (type) {
+    case Fy_Operator32ArgsType_Const:
+        value = Fy_VM_getMem16(vm, address + 1);
+        instruction_size += 2;
+        break;
+    case Fy_Operator32ArgsType_Reg16Reg16: {
+        uint8_t high_reg_id = Fy_VM_getMem8(vm, address + 1);
+        uint8_t low_reg_id = Fy_VM_getMem8(vm, address + 2);
+        uint16_t high, low;
+
+        if (!Fy_VM_getReg16(vm, high_reg_id, &high) || !Fy_VM_getReg16(vm, low_reg_id, &low))
+            return;
+
+        value = ((uint32_t)high << 16) | low;
+        instruction_size += 1 + 1;
+        break;
+    }
+    case Fy_Operator32ArgsType_Memory32: {
+        uint16_t value_address;
+        uint16_t memory_param_size;
+
+        memory_param_size = Fy_VM_readMemoryParam(vm, address + 1, &value_address);
+        // Stored like two words, the low word first
+        value = Fy_VM_getMem16(vm, value_address) | ((uint32_t)Fy_VM_getMem16(vm, value_address + 2) << 16);
+        instruction_size += memory_param_size;
+        break;
+    }
+    default:
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_InvalidOpcode, "32-bit operator id '%d'", type);
+        return;
+    }
+
+    Fy_VM_runOperator32(vm, operator, value);
+    vm->reg_ip += instruction_size;
+}
+
+static uint16_t Fy_instructionTypeConditional_getsize(Fy_Instruction_Conditional *instruction) {
+    uint16_t size = 1; // Because we have one info byte
+
+    switch (instruction->type) {
+    case Fy_ConditionalArgsType_Reg16Reg16:
+        size += 1 + 1;
+        break;
+    case Fy_ConditionalArgsType_Reg16Memory16:
+        size += 1 + Fy_InlineValue_getMapping(&instruction->as_reg16mem16.address, NULL);
+        break;
+    case Fy_ConditionalArgsType_Reg8:
+        size += 1;
+        break;
+    case Fy_ConditionalArgsType_Memory8:
+        size += Fy_InlineValue_getMapping(&instruction->as_mem8.address, NULL);
+        break;
+    default:
+        FY_UNREACHABLE();
+    }
+
+    return size;
+}
+
+static void Fy_instructionTypeConditional_write(Fy_Generator *generator, Fy_Instruction_Conditional *instruction) {
+    Fy_Generator_addByte(generator, (instruction->type << 4) + instruction->condition);
+    switch (instruction->type) {
+    case Fy_ConditionalArgsType_Reg16Reg16:
+        Fy_Generator_addByte(generator, instruction->as_reg16reg16.reg_id);
+        Fy_Generator_addByte(generator, instruction->as_reg16reg16.reg2_id);
+        break;
+    case Fy_ConditionalArgsType_Reg16Memory16:
+        Fy_Generator_addByte(generator, instruction->as_reg16mem16.reg_id);
+        Fy_Generator_addMemory(generator, &instruction->as_reg16mem16.address);
+        break;
+    case Fy_ConditionalArgsType_Reg8:
+        Fy_Generator_addByte(generator, instruction->as_reg8);
+        break;
+    case Fy_ConditionalArgsType_Memory8:
+        Fy_Generator_addMemory(generator, &instruction->as_mem8.address);
+        break;
+    default:
+        FY_UNREACHABLE();
+    }
+}
+
+/* Runs cmovcc and setcc, neither of them changes the flags */
+static void Fy_instructionTypeConditional_run(Fy_VM *vm, uint16_t address) {
+    uint8_t info_byte = Fy_VM_getMem8(vm, address + 0);
+    uint8_t type = info_byte >> 4;
+    uint8_t condition = info_byte & 0x0f;
+    uint16_t instruction_size = 1 + 1; // How much we need to advance
+    uint8_t flags = vm->flags;
+    bool is_met = Fy_VM_isConditionMet(vm, condition);
+
+    // An invalid condition id is a runtime error
+    if (!vm->running)
+        return;
+
+    switch (type) {
+    case Fy_ConditionalArgsType_Reg16Reg16: {
+        uint8_t reg_id = Fy_VM_getMem8(vm, address + 1);
+        uint8_t reg2_id = Fy_VM_getMem8(vm, address + 2);
+        uint16_t value;
+
+        if (is_met) {
+            if (!Fy_VM_getReg16(vm, reg2_id, &value) || !Fy_VM_setReg16(vm, reg_id, value))
+                return;
+        }
+        instruction_size += 1 + 1;
+        break;
+    }
+    case Fy_ConditionalArgsType_Reg16Memory16: {
+        uint8_t reg_id = Fy_VM_getMem8(vm, address + 1);
+        uint16_t value_address;
+        uint16_t memory_param_size;
+
+        memory_param_size = Fy_VM_readMemoryParam(vm, address + 2, &value_address);
+        if (is_met) {
+            if (!Fy_VM_setReg16(vm, reg_id, Fy_VM_getMem16(vm, value_address)))
+                return;
+        }
+        instruction_size += 1 + memory_param_size;
+        break;
+    }
+    case Fy_ConditionalArgsType_Reg8: {
+        uint8_t reg_id = Fy_VM_getMem8(vm, address + 1);
+
+        if (!Fy_VM_setReg8(vm, reg_id, is_met ? 1 : 0))
+            return;
+        instruction_size += 1;
+        break;
+    }
+    case Fy_ConditionalArgsType_Memory8: {
+        uint16_t value_address;
+        uint16_t memory_param_size;
+
+        memory_param_size = Fy_VM_readMemoryParam(vm, address + 1, &value_address);
+        Fy_VM_setMem8(vm, value_address, is_met ? 1 : 0);
+        instruction_size += memory_param_size;
+        break;
+    }
+    default:
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_InvalidOpcode, "Conditional instruction type id '%d'", type);
+        return;
+    }
+
+    vm->flags = flags;
+    vm->reg_ip += instruction_size;
+}
+
+static uint16_t Fy_instructionTypeFpuOperator_getsize(Fy_Instruction_FpuOperator *instruction) {
+    uint16_t size = 1; // Because we have one info byte
+
+    switch (instruction->type) {
+    case Fy_FpuArgsType_RegFloatRegFloat:
+    case Fy_FpuArgsType_RegFloatReg16:
+    case Fy_FpuArgsType_Reg16RegFloat:
+        size += 1 + 1;
+        break;
+    case Fy_FpuArgsType_RegFloatMemory32:
+    case Fy_FpuArgsType_Memory32RegFloat:
+        size += 1 + Fy_InlineValue_getMapping(&instruction->as_mem32.address, NULL);
+        break;
+    default:
+        FY_UNREACHABLE();
+    }
+
+    return size;
+}
+
+static void Fy_instructionTypeFpuOperator_write(Fy_Generator *generator, Fy_Instruction_FpuOperator *instruction) {
+    Fy_Generator_addByte(generator, (instruction->type << 4) + instruction->operator);
+    switch (instruction->type) {
+    case Fy_FpuArgsType_RegFloatRegFloat:
+    case Fy_FpuArgsType_RegFloatReg16:
+    case Fy_FpuArgsType_Reg16RegFloat:
+        Fy_Generator_addByte(generator, instruction->as_regs.reg_id);
+        Fy_Generator_addByte(generator, instruction->as_regs.reg2_id);
+        break;
+    case Fy_FpuArgsType_RegFloatMemory32:
+    case Fy_FpuArgsType_Memory32RegFloat:
+        Fy_Generator_addByte(generator, instruction->as_mem32.reg_id);
+        Fy_Generator_addMemory(generator, &instruction->as_mem32.address);
+        break;
+    default:
+        FY_UNREACHABLE();
+    }
+}
+
+static float Fy_getMemFloat(Fy_VM *vm, uint16_t address) {
+    // Stored like two words, the low word first
+    return Fy_Coprocessor_floatFromBits(Fy_VM_getMem16(vm, address) | ((uint32_t)Fy_VM_getMem16(vm, address + 2) << 16));
+}
+
+static void Fy_instructionTypeFpuOperator_run(Fy_VM *vm, uint16_t address) {
+    uint8_t info_byte = Fy_VM_getMem8(vm, address + 0);
+    uint8_t type = info_byte >> 4;
+    uint8_t operator = info_byte & 0x0f;
+    uint8_t reg_id = Fy_VM_getMem8(vm, address + 1);
+    uint16_t instruction_size = 1 + 1 + 1; // How much we need to advance
+
+    switch (type) {
+    case Fy_FpuArgsType_RegFloatRegFloat: {
+        uint8_t reg2_id = Fy_VM_getMem8(vm, address + 2);
+        float value;
+
+        if (!Fy_VM_getRegFloat(vm, reg2_id, &value) || !Fy_VM_runFpuOperator(vm, operator, reg_id, value))
+            return;
+        instruction_size += 1;
+        break;
+    }
+    case Fy_FpuArgsType_RegFloatMemory32: {
+        uint16_t value_address;
+        uint16_t memory_param_size;
+
+        memory_param_size = Fy_VM_readMemoryParam(vm, address + 2, &value_address);
+        if (!Fy_VM_runFpuOperator(vm, operator, reg_id, Fy_getMemFloat(vm, value_address)))
+            return;
+        instruction_size += memory_param_size;
+        break;
+    }
+    case Fy_FpuArgsType_Memory32RegFloat: {
+        uint16_t value_address;
+        uint16_t memory_param_size;
+        uint32_t bits;
+        float value;
+
+        memory_param_size = Fy_VM_readMemoryParam(vm, address + 2, &value_address);
+        if (!Fy_VM_getRegFloat(vm, reg_id, &value))
+            return;
+        bits = Fy_Coprocessor_floatToBits(value);
+        Fy_VM_setMem16(vm, value_address, (uint16_t)bits);
+        Fy_VM_setMem16(vm, value_address + 2, (uint16_t)(bits >> 16));
+        instruction_size += memory_param_size;
+        break;
+    }
+    case Fy_FpuArgsType_RegFloatReg16: {
+        uint8_t reg16_id = Fy_VM_getMem8(vm, address + 2);
+        uint16_t value;
+
+        if (!Fy_VM_getReg16(vm, reg16_id, &value) || !Fy_VM_setRegFloat(vm, reg_id, (int16_t)value))
+            return;
+        instruction_size += 1;
+        break;
+    }
+    case Fy_FpuArgsType_Reg16RegFloat: {
+        uint8_t float_reg_id = Fy_VM_getMem8(vm, address + 2);
+        float value;
+
+        if (!Fy_VM_getRegFloat(vm, float_reg_id, &value))
+            return;
+        if (!Fy_VM_setReg16(vm, reg_id, (uint16_t)Fy_Coprocessor_floatToInt16(value)))
+            return;
+        instruction_size += 1;
+        break;
+    }
+    default:
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_InvalidOpcode, "FPU operator type id '%d'", type);
+        return;
+    }
+
+    vm->reg_ip += instruction_size;
+}
+
 /* Type definitions */
 Fy_InstructionType Fy_instructionTypeNop = {
     .variable_size = false,
@@ -1051,6 +1713,96 @@ Fy_InstructionType Fy_instructionTypeCbw = {
     .write_func = NULL,
     .run_func = Fy_instructionTypeCbw_run
 };
+Fy_InstructionType Fy_instructionTypeIret = {
+    .variable_size = false,
+    .additional_size = 0,
+    .write_func = NULL,
+    .run_func = Fy_instructionTypeIret_run
+};
+Fy_InstructionType Fy_instructionTypeLeaLabel = {
+    .variable_size = false,
+    .additional_size = 3,
+    .write_func = (Fy_InstructionWriteFunc)Fy_instructionTypeLeaLabel_write,
+    .run_func = Fy_instructionTypeLeaLabel_run
+};
+Fy_InstructionType Fy_instructionTypeMovsb = {
+    .variable_size = false,
+    .additional_size = 0,
+    .write_func = NULL,
+    .run_func = Fy_instructionTypeMovsb_run
+};
+Fy_InstructionType Fy_instructionTypeMovsw = {
+    .variable_size = false,
+    .additional_size = 0,
+    .write_func = NULL,
+    .run_func = Fy_instructionTypeMovsw_run
+};
+Fy_InstructionType Fy_instructionTypeStosb = {
+    .variable_size = false,
+    .additional_size = 0,
+    .write_func = NULL,
+    .run_func = Fy_instructionTypeStosb_run
+};
+Fy_InstructionType Fy_instructionTypeStosw = {
+    .variable_size = false,
+    .additional_size = 0,
+    .write_func = NULL,
+    .run_func = Fy_instructionTypeStosw_run
+};
+Fy_InstructionType Fy_instructionTypeCmpsb = {
+    .variable_size = false,
+    .additional_size = 0,
+    .write_func = NULL,
+    .run_func = Fy_instructionTypeCmpsb_run
+};
+Fy_InstructionType Fy_instructionTypeCmpsw = {
+    .variable_size = false,
+    .additional_size = 0,
+    .write_func = NULL,
+    .run_func = Fy_instructionTypeCmpsw_run
+};
+Fy_InstructionType Fy_instructionTypeOperator32 = {
+    .variable_size = true,
+    .getsize_func = (Fy_InstructionGetSizeFunc)Fy_instructionTypeOperator32_getsize,
+    .write_func = (Fy_InstructionWriteFunc)Fy_instructionTypeOperator32_write,
+    .run_func = Fy_instructionTypeOperator32_run
+};
+Fy_InstructionType Fy_instructionTypeLoop = {
+    .variable_size = false,
+    .additional_size = 2,
+    .write_func = (Fy_InstructionWriteFunc)Fy_instructionTypeLoop_write,
+    .run_func = Fy_instructionTypeLoop_run
+};
+Fy_InstructionType Fy_instructionTypeLoopz = {
+    .variable_size = false,
+    .additional_size = 2,
+    .write_func = (Fy_InstructionWriteFunc)Fy_instructionTypeLoopz_write,
+    .run_func = Fy_instructionTypeLoopz_run
+};
+Fy_InstructionType Fy_instructionTypeLoopnz = {
+    .variable_size = false,
+    .additional_size = 2,
+    .write_func = (Fy_InstructionWriteFunc)Fy_instructionTypeLoopnz_write,
+    .run_func = Fy_instructionTypeLoopnz_run
+};
+Fy_InstructionType Fy_instructionTypeFpuOperator = {
+    .variable_size = true,
+    .getsize_func = (Fy_InstructionGetSizeFunc)Fy_instructionTypeFpuOperator_getsize,
+    .write_func = (Fy_InstructionWriteFunc)Fy_instructionTypeFpuOperator_write,
+    .run_func = Fy_instructionTypeFpuOperator_run
+};
+Fy_InstructionType Fy_instructionTypeBinaryOperator3 = {
+    .variable_size = true,
+    .getsize_func = (Fy_InstructionGetSizeFunc)Fy_instructionTypeBinaryOperator3_getsize,
+    .write_func = (Fy_InstructionWriteFunc)Fy_instructionTypeBinaryOperator3_write,
+    .run_func = Fy_instructionTypeBinaryOperator3_run
+};
+Fy_InstructionType Fy_instructionTypeConditional = {
+    .variable_size = true,
+    .getsize_func = (Fy_InstructionGetSizeFunc)Fy_instructionTypeConditional_getsize,
+    .write_func = (Fy_InstructionWriteFunc)Fy_instructionTypeConditional_write,
+    .run_func = Fy_instructionTypeConditional_run
+};
 
 Fy_InstructionType* const Fy_instructionTypes[] = {
     &Fy_instructionTypeNop,
@@ -1086,5 +1838,20 @@ Fy_InstructionType* const Fy_instructionTypes[] = {
     &Fy_instructionTypeIdivReg8,
     &Fy_instructionTypeBinaryOperator,
     &Fy_instructionTypeUnaryOperator,
-    &Fy_instructionTypeCbw
+    &Fy_instructionTypeCbw,
+    &Fy_instructionTypeIret,
+    &Fy_instructionTypeLeaLabel,
+    &Fy_instructionTypeMovsb,
+    &Fy_instructionTypeMovsw,
+    &Fy_instructionTypeStosb,
+    &Fy_instructionTypeStosw,
+    &Fy_instructionTypeCmpsb,
+    &Fy_instructionTypeCmpsw,
+    &Fy_instructionTypeOperator32,
+    &Fy_instructionTypeLoop,
+    &Fy_instructionTypeLoopz,
+    &Fy_instructionTypeLoopnz,
+    &Fy_instructionTypeConditional,
+    &Fy_instructionTypeFpuOperator,
+    &Fy_instructionTypeBinaryOperator3
 };
@@ -15,7 +15,11 @@ typedef struct Fy_Parser Fy_Parser;
 typedef struct Fy_ParserParseRule Fy_ParserParseRule;
 typedef struct Fy_Instruction Fy_Instruction;
 typedef enum Fy_BinaryOperatorArgsType Fy_BinaryOperatorArgsType;
+typedef enum Fy_BinaryOperator3ArgsType Fy_BinaryOperator3ArgsType;
 typedef enum Fy_UnaryOperatorArgsType Fy_UnaryOperatorArgsType;
+typedef enum Fy_Operator32ArgsType Fy_Operator32ArgsType;
+typedef enum Fy_ConditionalArgsType Fy_ConditionalArgsType;
+typedef enum Fy_FpuArgsType Fy_FpuArgsType;
 typedef enum Fy_BinaryOperator Fy_BinaryOperator;
 typedef struct Fy_InstructionType Fy_InstructionType;
 typedef struct Fy_Instruction_OpLabel Fy_Instruction_OpLabel;
@@ -25,8 +29,13 @@ typedef struct Fy_Instruction_OpReg8 Fy_Instruction_OpReg8;
 typedef struct Fy_Instruction_OpReg16 Fy_Instruction_OpReg16;
 typedef struct Fy_Instruction_OpMem Fy_Instruction_OpMem;
 typedef struct Fy_Instruction_OpReg16Mem Fy_Instruction_OpReg16Mem;
+typedef struct Fy_Instruction_OpReg16Label Fy_Instruction_OpReg16Label;
 typedef struct Fy_Instruction_BinaryOperator Fy_Instruction_BinaryOperator;
+typedef struct Fy_Instruction_BinaryOperator3 Fy_Instruction_BinaryOperator3;
 typedef struct Fy_Instruction_UnaryOperator Fy_Instruction_UnaryOperator;
+typedef struct Fy_Instruction_Operator32 Fy_Instruction_Operator32;
+typedef struct Fy_Instruction_Conditional Fy_Instruction_Conditional;
+typedef struct Fy_Instruction_FpuOperator Fy_Instruction_FpuOperator;
 typedef void (*Fy_InstructionWriteFunc)(Fy_Generator*, Fy_Instruction*);
 typedef uint16_t (*Fy_InstructionGetSizeFunc)(Fy_Instruction*);
 typedef void (*Fy_InstructionRunFunc)(Fy_VM*, uint16_t);
@@ -66,6 +75,16 @@ enum Fy_BinaryOperatorArgsType {
     Fy_BinaryOperatorArgsType_Memory8Reg8
 };
 
+/* Three operand forms, the first register gets the result */
+enum Fy_BinaryOperator3ArgsType {
+    Fy_BinaryOperator3ArgsType_Reg16Reg16Reg16 = 1,
+    Fy_BinaryOperator3ArgsType_Reg16Reg16Const,
+    Fy_BinaryOperator3ArgsType_Reg16Reg16Memory16,
+    Fy_BinaryOperator3ArgsType_Reg8Reg8Reg8,
+    Fy_BinaryOperator3ArgsType_Reg8Reg8Const,
+    Fy_BinaryOperator3ArgsType_Reg8Reg8Memory8
+};
+
 enum Fy_UnaryOperatorArgsType {
     Fy_UnaryOperatorArgsType_Reg16 = 1,
     Fy_UnaryOperatorArgsType_Mem16,
@@ -73,6 +92,32 @@ enum Fy_UnaryOperatorArgsType {
     Fy_UnaryOperatorArgsType_Mem8
 };
 
+/* The source operand of a 32-bit operator, the destination is always dx:ax */
+enum Fy_Operator32ArgsType {
+    Fy_Operator32ArgsType_Const = 1,
+    Fy_Operator32ArgsType_Reg16Reg16,
+    Fy_Operator32ArgsType_Memory32
+};
+
+enum Fy_ConditionalArgsType {
+    /* cmovcc forms */
+    Fy_ConditionalArgsType_Reg16Reg16 = 1,
+    Fy_ConditionalArgsType_Reg16Memory16,
+    /* setcc forms */
+    Fy_ConditionalArgsType_Reg8,
+    Fy_ConditionalArgsType_Memory8
+};
+
+enum Fy_FpuArgsType {
+    Fy_FpuArgsType_RegFloatRegFloat = 1,
+    Fy_FpuArgsType_RegFloatMemory32,
+    /* Only used by fmov, to store a float */
+    Fy_FpuArgsType_Memory32RegFloat,
+    /* Only used by fcvt */
+    Fy_FpuArgsType_RegFloatReg16,
+    Fy_FpuArgsType_Reg16RegFloat
+};
+
 /* Inheriting instructions */
 struct Fy_Instruction_OpReg8Const {
     FY_INSTRUCTION_BASE;
@@ -106,6 +151,15 @@ struct Fy_Instruction_OpLabel {
     uint16_t address;
 };
 
+struct Fy_Instruction_OpReg16Label {
+    FY_INSTRUCTION_BASE;
+    uint8_t reg_id;
+    char *name;
+    /* The referenced instruction offset */
+    size_t instruction_offset;
+    uint16_t address;
+};
+
 struct Fy_Instruction_OpConst8 {
     FY_INSTRUCTION_BASE;
     uint8_t value;
@@ -204,6 +258,47 @@ struct Fy_Instruction_BinaryOperator {
     };
 };
 
+/* Parsed by the binary operator rules, but with a type byte of its own */
+struct Fy_Instruction_BinaryOperator3 {
+    FY_INSTRUCTION_BASE;
+    Fy_BinaryOperator3ArgsType type;
+    Fy_BinaryOperator operator;
+    union {
+        struct {
+            uint8_t reg_id;
+            uint8_t reg2_id;
+            uint8_t reg3_id;
+        } as_reg16reg16reg16;
+        struct {
+            uint8_t reg_id;
+            uint8_t reg2_id;
+            uint16_t value;
+        } as_reg16reg16const;
+        struct {
+            uint8_t reg_id;
+            uint8_t reg2_id;
+            Fy_AST *ast;
+            Fy_InlineValue address;
+        } as_reg16reg16mem16;
+        struct {
+            uint8_t reg_id;
+            uint8_t reg2_id;
+            uint8_t reg3_id;
+        } as_reg8reg8reg8;
+        struct {
+            uint8_t reg_id;
+            uint8_t reg2_id;
+            uint8_t value;
+        } as_reg8reg8const;
+        struct {
+            uint8_t reg_id;
+            uint8_t reg2_id;
+            Fy_AST *ast;
+            Fy_InlineValue address;
+        } as_reg8reg8mem8;
+    };
+};
+
 struct Fy_Instruction_UnaryOperator {
     FY_INSTRUCTION_BASE;
     Fy_UnaryOperatorArgsType type;
@@ -222,6 +317,64 @@ struct Fy_Instruction_UnaryOperator {
     };
 };
 
+struct Fy_Instruction_Operator32 {
+    FY_INSTRUCTION_BASE;
+    Fy_Operator32ArgsType type;
+    Fy_BinaryOperator operator;
+    union {
+        uint16_t as_const;
+        struct {
+            uint8_t high_reg_id;
+            uint8_t low_reg_id;
+        } as_reg16reg16;
+        struct {
+            Fy_AST *ast;
+            Fy_InlineValue address;
+        } as_mem32;
+    };
+};
+
+struct Fy_Instruction_Conditional {
+    FY_INSTRUCTION_BASE;
+    Fy_ConditionalArgsType type;
+    Fy_Condition condition;
+    union {
+        struct {
+            uint8_t reg_id;
+            uint8_t reg2_id;
+        } as_reg16reg16;
+        struct {
+            uint8_t reg_id;
+            Fy_AST *ast;
+            Fy_InlineValue address;
+        } as_reg16mem16;
+        uint8_t as_reg8;
+        struct {
+            Fy_AST *ast;
+            Fy_InlineValue address;
+        } as_mem8;
+    };
+};
+
+struct Fy_Instruction_FpuOperator {
+    FY_INSTRUCTION_BASE;
+    Fy_FpuArgsType type;
+    Fy_FpuOperator operator;
+    union {
+        /* Used by both register-register forms, the first register is the destination */
+        struct {
+            uint8_t reg_id;
+            uint8_t reg2_id;
+        } as_regs;
+        /* Used by both memory forms */
+        struct {
+            uint8_t reg_id;
+            Fy_AST *ast;
+            Fy_InlineValue address;
+        } as_mem32;
+    };
+};
+
 /* Instruction types */
 extern Fy_InstructionType Fy_instructionTypeNop;
 extern Fy_InstructionType Fy_instructionTypeMovReg16Const;
@@ -274,8 +427,23 @@ extern Fy_InstructionType Fy_instructionTypeAddReg8Reg8;
 extern Fy_InstructionType Fy_instructionTypeBinaryOperator;
 extern Fy_InstructionType Fy_instructionTypeUnaryOperator;
 extern Fy_InstructionType Fy_instructionTypeCbw;
+extern Fy_InstructionType Fy_instructionTypeIret;
+extern Fy_InstructionType Fy_instructionTypeLeaLabel;
+extern Fy_InstructionType Fy_instructionTypeMovsb;
+extern Fy_InstructionType Fy_instructionTypeMovsw;
+extern Fy_InstructionType Fy_instructionTypeStosb;
+extern Fy_InstructionType Fy_instructionTypeStosw;
+extern Fy_InstructionType Fy_instructionTypeCmpsb;
+extern Fy_InstructionType Fy_instructionTypeCmpsw;
+extern Fy_InstructionType Fy_instructionTypeOperator32;
+extern Fy_InstructionType Fy_instructionTypeLoop;
+extern Fy_InstructionType Fy_instructionTypeLoopz;
+extern Fy_InstructionType Fy_instructionTypeLoopnz;
+extern Fy_InstructionType Fy_instructionTypeConditional;
+extern Fy_InstructionType Fy_instructionTypeFpuOperator;
+extern Fy_InstructionType Fy_instructionTypeBinaryOperator3;
 
-extern Fy_InstructionType* const Fy_instructionTypes[34];
+extern Fy_InstructionType* const Fy_instructionTypes[49];
 
 /* Instruction methods/functions */
 Fy_Instruction *Fy_Instruction_New(const Fy_InstructionType *type, size_t size);
@@ -57,8 +57,38 @@ const Fy_KeywordTokenDef Fy_keywordTokens[] = {
     { "jle", Fy_TokenType_Jle },
     { "jg", Fy_TokenType_Jg },
     { "jge", Fy_TokenType_Jge },
+    { "loop", Fy_TokenType_Loop },
+    { "loopz", Fy_TokenType_Loopz },
+    { "loope", Fy_TokenType_Loopz },
+    { "loopnz", Fy_TokenType_Loopnz },
+    { "loopne", Fy_TokenType_Loopnz },
+    { "cmove", Fy_TokenType_Cmove },
+    { "cmovne", Fy_TokenType_Cmovne },
+    { "cmovz", Fy_TokenType_Cmovz },
+    { "cmovnz", Fy_TokenType_Cmovnz },
+    { "cmovb", Fy_TokenType_Cmovb },
+    { "cmovbe", Fy_TokenType_Cmovbe },
+    { "cmova", Fy_TokenType_Cmova },
+    { "cmovae", Fy_TokenType_Cmovae },
+    { "cmovl", Fy_TokenType_Cmovl },
+    { "cmovle", Fy_TokenType_Cmovle },
+    { "cmovg", Fy_TokenType_Cmovg },
+    { "cmovge", Fy_TokenType_Cmovge },
+    { "sete", Fy_TokenType_Sete },
+    { "setne", Fy_TokenType_Setne },
+    { "setz", Fy_TokenType_Setz },
+    { "setnz", Fy_TokenType_Setnz },
+    { "setb", Fy_TokenType_Setb },
+    { "setbe", Fy_TokenType_Setbe },
+    { "seta", Fy_TokenType_Seta },
+    { "setae", Fy_TokenType_Setae },
+    { "setl", Fy_TokenType_Setl },
+    { "setle", Fy_TokenType_Setle },
+    { "setg", Fy_TokenType_Setg },
+    { "setge", Fy_TokenType_Setge },
     { "call", Fy_TokenType_Call },
     { "ret", Fy_TokenType_Ret },
+    { "iret", Fy_TokenType_Iret },
     { "end", Fy_TokenType_End },
     { "mov", Fy_TokenType_Mov },
     { "lea", Fy_TokenType_Lea },
@@ -70,6 +100,21 @@ const Fy_KeywordTokenDef Fy_keywordTokens[] = {
     { "shl", Fy_TokenType_Shl },
     { "shr", Fy_TokenType_Shr },
     { "cmp", Fy_TokenType_Cmp },
+    { "adc", Fy_TokenType_Adc },
+    { "sbb", Fy_TokenType_Sbb },
+    { "add32", Fy_TokenType_Add32 },
+    { "sub32", Fy_TokenType_Sub32 },
+    { "cmp32", Fy_TokenType_Cmp32 },
+    { "shl32", Fy_TokenType_Shl32 },
+    { "shr32", Fy_TokenType_Shr32 },
+    { "fmov", Fy_TokenType_Fmov },
+    { "fadd", Fy_TokenType_Fadd },
+    { "fsub", Fy_TokenType_Fsub },
+    { "fmul", Fy_TokenType_Fmul },
+    { "fdiv", Fy_TokenType_Fdiv },
+    { "fcmp", Fy_TokenType_Fcmp },
+    { "fsqrt", Fy_TokenType_Fsqrt },
+    { "fcvt", Fy_TokenType_Fcvt },
     { "div", Fy_TokenType_Div },
     { "idiv", Fy_TokenType_Idiv },
     { "neg", Fy_TokenType_Neg },
@@ -79,6 +124,12 @@ const Fy_KeywordTokenDef Fy_keywordTokens[] = {
     { "mul", Fy_TokenType_Mul },
     { "imul", Fy_TokenType_Imul },
     { "cbw", Fy_TokenType_Cbw },
+    { "movsb", Fy_TokenType_Movsb },
+    { "movsw", Fy_TokenType_Movsw },
+    { "stosb", Fy_TokenType_Stosb },
+    { "stosw", Fy_TokenType_Stosw },
+    { "cmpsb", Fy_TokenType_Cmpsb },
+    { "cmpsw", Fy_TokenType_Cmpsw },
     { "push", Fy_TokenType_Push },
     { "pop", Fy_TokenType_Pop },
     { "int", Fy_TokenType_Int },
@@ -88,6 +139,16 @@ const Fy_KeywordTokenDef Fy_keywordTokens[] = {
     { "dx", Fy_TokenType_Dx },
     { "sp", Fy_TokenType_Sp },
     { "bp", Fy_TokenType_Bp },
+    { "si", Fy_TokenType_Si },
+    { "di", Fy_TokenType_Di },
+    { "r8", Fy_TokenType_R8 },
+    { "r9", Fy_TokenType_R9 },
+    { "r10", Fy_TokenType_R10 },
+    { "r11", Fy_TokenType_R11 },
+    { "r12", Fy_TokenType_R12 },
+    { "r13", Fy_TokenType_R13 },
+    { "r14", Fy_TokenType_R14 },
+    { "r15", Fy_TokenType_R15 },
     { "ah", Fy_TokenType_Ah },
     { "al", Fy_TokenType_Al },
     { "bh", Fy_TokenType_Bh },
@@ -96,6 +157,14 @@ const Fy_KeywordTokenDef Fy_keywordTokens[] = {
     { "cl", Fy_TokenType_Cl },
     { "dh", Fy_TokenType_Dh },
     { "dl", Fy_TokenType_Dl },
+    { "f0", Fy_TokenType_F0 },
+    { "f1", Fy_TokenType_F1 },
+    { "f2", Fy_TokenType_F2 },
+    { "f3", Fy_TokenType_F3 },
+    { "f4", Fy_TokenType_F4 },
+    { "f5", Fy_TokenType_F5 },
+    { "f6", Fy_TokenType_F6 },
+    { "f7", Fy_TokenType_F7 },
     { "proc", Fy_TokenType_Proc },
     { "endp", Fy_TokenType_Endp },
     { "data", Fy_TokenType_Data },
@@ -104,6 +173,7 @@ const Fy_KeywordTokenDef Fy_keywordTokens[] = {
     { "code", Fy_TokenType_Code },
     { "byte", Fy_TokenType_Byte },
     { "word", Fy_TokenType_Word },
+    { "dword", Fy_TokenType_Dword },
     { "dup", Fy_TokenType_Dup }
 };
 
@@ -7,6 +7,13 @@ static Fy_Instruction *Fy_ParseDebugStack(Fy_Parser *parser);
 static Fy_Instruction *Fy_ParseEnd(Fy_Parser *parser);
 static Fy_Instruction *Fy_ParseRet(Fy_Parser *parser);
 static Fy_Instruction *Fy_ParseCbw(Fy_Parser *parser);
+static Fy_Instruction *Fy_ParseIret(Fy_Parser *parser);
+static Fy_Instruction *Fy_ParseMovsb(Fy_Parser *parser);
+static Fy_Instruction *Fy_ParseMovsw(Fy_Parser *parser);
+static Fy_Instruction *Fy_ParseStosb(Fy_Parser *parser);
+static Fy_Instruction *Fy_ParseStosw(Fy_Parser *parser);
+static Fy_Instruction *Fy_ParseCmpsb(Fy_Parser *parser);
+static Fy_Instruction *Fy_ParseCmpsw(Fy_Parser *parser);
 static Fy_Instruction *Fy_ParseRetConst16(Fy_Parser *parser, Fy_InstructionArg *arg);
 static Fy_Instruction *Fy_ParsePushConst(Fy_Parser *parser, Fy_InstructionArg *arg);
 static Fy_Instruction *Fy_ParsePushReg16(Fy_Parser *parser, Fy_InstructionArg *arg);
@@ -21,16 +28,20 @@ static Fy_Instruction *Fy_ParseDivReg8(Fy_Parser *parser, Fy_InstructionArg *arg
 static Fy_Instruction *Fy_ParseIdivReg16(Fy_Parser *parser, Fy_InstructionArg *arg);
 static Fy_Instruction *Fy_ParseIdivReg8(Fy_Parser *parser, Fy_InstructionArg *arg);
 static Fy_Instruction *Fy_ParseLea(Fy_Parser *parser, Fy_InstructionArg *arg1, Fy_InstructionArg *arg2);
+static Fy_Instruction *Fy_ParseLeaLabel(Fy_Parser *parser, Fy_InstructionArg *arg1, Fy_InstructionArg *arg2);
 
 /* Process-function (parsing step 2) declarations */
 static void Fy_ProcessOpLabel(Fy_Parser *parser, Fy_Instruction_OpLabel *instruction);
 static void Fy_ProcessOpReg16Mem(Fy_Parser *parser, Fy_Instruction_OpReg16Mem *instruction);
+static void Fy_ProcessOpReg16Label(Fy_Parser *parser, Fy_Instruction_OpReg16Label *instruction);
 
 /* Process-label-function (parsing step 3) declarations */
 static void Fy_ProcessLabelOpLabel(Fy_Parser *parser, Fy_Instruction_OpLabel *instruction);
+static void Fy_ProcessLabelOpReg16Label(Fy_Parser *parser, Fy_Instruction_OpReg16Label *instruction);
 
 /* Custom instruction delete functions */
 static void Fy_DeleteLea(Fy_Instruction_OpReg16Mem *instruction);
+static void Fy_DeleteLeaLabel(Fy_Instruction_OpReg16Label *instruction);
 
 /* Function to parse anything found in text */
 static bool Fy_Parser_parseLine(Fy_Parser *parser);
@@ -41,11 +52,34 @@ typedef struct Fy_BinaryOperatorRule {
     Fy_BinaryOperatorArgsType binary_instruction_type;
 } Fy_BinaryOperatorRule;
 
+typedef struct Fy_BinaryOperator3Rule {
+    Fy_InstructionArgType arg1_type, arg2_type, arg3_type;
+    Fy_BinaryOperator3ArgsType binary3_instruction_type;
+} Fy_BinaryOperator3Rule;
+
 typedef struct Fy_UnaryOperatorRule {
     Fy_InstructionArgType arg_type;
     Fy_UnaryOperatorArgsType unary_instruction_type;
 } Fy_UnaryOperatorRule;
 
+typedef struct Fy_Operator32Rule {
+    uint8_t amount_args;
+    Fy_InstructionArgType arg1_type, arg2_type;
+    Fy_Operator32ArgsType operator32_instruction_type;
+} Fy_Operator32Rule;
+
+typedef struct Fy_ConditionalRule {
+    Fy_ConditionalOperation operation;
+    uint8_t amount_args;
+    Fy_InstructionArgType arg1_type, arg2_type;
+    Fy_ConditionalArgsType conditional_instruction_type;
+} Fy_ConditionalRule;
+
+typedef struct Fy_FpuRule {
+    Fy_InstructionArgType arg1_type, arg2_type;
+    Fy_FpuArgsType fpu_instruction_type;
+} Fy_FpuRule;
+
 /* Define rules */
 static const Fy_ParserParseRule Fy_parseRuleNop = {
     .type = Fy_ParserParseRuleType_Custom,
@@ -182,6 +216,219 @@ static const Fy_ParserParseRule Fy_parseRuleJge = {
         .instruction_type = &Fy_instructionTypeJge
     }
 };
+static const Fy_ParserParseRule Fy_parseRuleLoop = {
+    .type = Fy_ParserParseRuleType_Jump,
+    .start_token = Fy_TokenType_Loop,
+    .as_jump = {
+        .instruction_type = &Fy_instructionTypeLoop
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleLoopz = {
+    .type = Fy_ParserParseRuleType_Jump,
+    .start_token = Fy_TokenType_Loopz,
+    .as_jump = {
+        .instruction_type = &Fy_instructionTypeLoopz
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleLoopnz = {
+    .type = Fy_ParserParseRuleType_Jump,
+    .start_token = Fy_TokenType_Loopnz,
+    .as_jump = {
+        .instruction_type = &Fy_instructionTypeLoopnz
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleCmove = {
+    .type = Fy_ParserParseRuleType_Conditional,
+    .start_token = Fy_TokenType_Cmove,
+    .as_conditional = {
+        .operation = Fy_ConditionalOperation_Move,
+        .condition = Fy_Condition_E
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleCmovne = {
+    .type = Fy_ParserParseRuleType_Conditional,
+    .start_token = Fy_TokenType_Cmovne,
+    .as_conditional = {
+        .operation = Fy_ConditionalOperation_Move,
+        .condition = Fy_Condition_Ne
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleCmovz = {
+    .type = Fy_ParserParseRuleType_Conditional,
+    .start_token = Fy_TokenType_Cmovz,
+    .as_conditional = {
+        .operation = Fy_ConditionalOperation_Move,
+        .condition = Fy_Condition_E
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleCmovnz = {
+    .type = Fy_ParserParseRuleType_Conditional,
+    .start_token = Fy_TokenType_Cmovnz,
+    .as_conditional = {
+        .operation = Fy_ConditionalOperation_Move,
+        .condition = Fy_Condition_Ne
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleCmovb = {
+    .type = Fy_ParserParseRuleType_Conditional,
+    .start_token = Fy_TokenType_Cmovb,
+    .as_conditional = {
+        .operation = Fy_ConditionalOperation_Move,
+        .condition = Fy_Condition_B
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleCmovbe = {
+    .type = Fy_ParserParseRuleType_Conditional,
+    .start_token = Fy_TokenType_Cmovbe,
+    .as_conditional = {
+        .operation = Fy_ConditionalOperation_Move,
+        .condition = Fy_Condition_Be
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleCmova = {
+    .type = Fy_ParserParseRuleType_Conditional,
+    .start_token = Fy_TokenType_Cmova,
+    .as_conditional = {
+        .operation = Fy_ConditionalOperation_Move,
+        .condition = Fy_Condition_A
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleCmovae = {
+    .type = Fy_ParserParseRuleType_Conditional,
+    .start_token = Fy_TokenType_Cmovae,
+    .as_conditional = {
+        .operation = Fy_ConditionalOperation_Move,
+        .condition = Fy_Condition_Ae
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleCmovl = {
+    .type = Fy_ParserParseRuleType_Conditional,
+    .start_token = Fy_TokenType_Cmovl,
+    .as_conditional = {
+        .operation = Fy_ConditionalOperation_Move,
+        .condition = Fy_Condition_L
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleCmovle = {
+    .type = Fy_ParserParseRuleType_Conditional,
+    .start_token = Fy_TokenType_Cmovle,
+    .as_conditional = {
+        .operation = Fy_ConditionalOperation_Move,
+        .condition = Fy_Condition_Le
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleCmovg = {
+    .type = Fy_ParserParseRuleType_Conditional,
+    .start_token = Fy_TokenType_Cmovg,
+    .as_conditional = {
+        .operation = Fy_ConditionalOperation_Move,
+        .condition = Fy_Condition_G
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleCmovge = {
+    .type = Fy_ParserParseRuleType_Conditional,
+    .start_token = Fy_TokenType_Cmovge,
+    .as_conditional = {
+        .operation = Fy_ConditionalOperation_Move,
+        .condition = Fy_Condition_Ge
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleSete = {
+    .type = Fy_ParserParseRuleType_Conditional,
+    .start_token = Fy_TokenType_Sete,
+    .as_conditional = {
+        .operation = Fy_ConditionalOperation_Set,
+        .condition = Fy_Condition_E
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleSetne = {
+    .type = Fy_ParserParseRuleType_Conditional,
+    .start_token = Fy_TokenType_Setne,
+    .as_conditional = {
+        .operation = Fy_ConditionalOperation_Set,
+        .condition = Fy_Condition_Ne
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleSetz = {
+    .type = Fy_ParserParseRuleType_Conditional,
+    .start_token = Fy_TokenType_Setz,
+    .as_conditional = {
+        .operation = Fy_ConditionalOperation_Set,
+        .condition = Fy_Condition_E
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleSetnz = {
+    .type = Fy_ParserParseRuleType_Conditional,
+    .start_token = Fy_TokenType_Setnz,
+    .as_conditional = {
+        .operation = Fy_ConditionalOperation_Set,
+        .condition = Fy_Condition_Ne
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleSetb = {
+    .type = Fy_ParserParseRuleType_Conditional,
+    .start_token = Fy_TokenType_Setb,
+    .as_conditional = {
+        .operation = Fy_ConditionalOperation_Set,
+        .condition = Fy_Condition_B
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleSetbe = {
+    .type = Fy_ParserParseRuleType_Conditional,
+    .start_token = Fy_TokenType_Setbe,
+    .as_conditional = {
+        .operation = Fy_ConditionalOperation_Set,
+        .condition = Fy_Condition_Be
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleSeta = {
+    .type = Fy_ParserParseRuleType_Conditional,
+    .start_token = Fy_TokenType_Seta,
+    .as_conditional = {
+        .operation = Fy_ConditionalOperation_Set,
+        .condition = Fy_Condition_A
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleSetae = {
+    .type = Fy_ParserParseRuleType_Conditional,
+    .start_token = Fy_TokenType_Setae,
+    .as_conditional = {
+        .operation = Fy_ConditionalOperation_Set,
+        .condition = Fy_Condition_Ae
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleSetl = {
+    .type = Fy_ParserParseRuleType_Conditional,
+    .start_token = Fy_TokenType_Setl,
+    .as_conditional = {
+        .operation = Fy_ConditionalOperation_Set,
+        .condition = Fy_Condition_L
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleSetle = {
+    .type = Fy_ParserParseRuleType_Conditional,
+    .start_token = Fy_TokenType_Setle,
+    .as_conditional = {
+        .operation = Fy_ConditionalOperation_Set,
+        .condition = Fy_Condition_Le
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleSetg = {
+    .type = Fy_ParserParseRuleType_Conditional,
+    .start_token = Fy_TokenType_Setg,
+    .as_conditional = {
+        .operation = Fy_ConditionalOperation_Set,
+        .condition = Fy_Condition_G
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleSetge = {
+    .type = Fy_ParserParseRuleType_Conditional,
+    .start_token = Fy_TokenType_Setge,
+    .as_conditional = {
+        .operation = Fy_ConditionalOperation_Set,
+        .condition = Fy_Condition_Ge
+    }
+};
 static const Fy_ParserParseRule Fy_parseRulePushConst = {
     .type = Fy_ParserParseRuleType_Custom,
     .start_token = Fy_TokenType_Push,
@@ -261,6 +508,19 @@ static const Fy_ParserParseRule Fy_parseRuleLea = {
         .delete_func = (Fy_InstructionCustomDeleteFunc)Fy_DeleteLea
     }
 };
+static const Fy_ParserParseRule Fy_parseRuleLeaLabel = {
+    .type = Fy_ParserParseRuleType_Custom,
+    .start_token = Fy_TokenType_Lea,
+    .as_custom = {
+        .amount_params = 2,
+        .arg1_type = Fy_InstructionArgType_Reg16,
+        .arg2_type = Fy_InstructionArgType_Label,
+        .func_two_params = Fy_ParseLeaLabel,
+        .process_func = (Fy_InstructionProcessFunc)Fy_ProcessOpReg16Label,
+        .process_label_func = (Fy_InstructionProcessLabelFunc)Fy_ProcessLabelOpReg16Label,
+        .delete_func = (Fy_InstructionCustomDeleteFunc)Fy_DeleteLeaLabel
+    }
+};
 static const Fy_ParserParseRule Fy_parseRuleInt = {
     .type = Fy_ParserParseRuleType_Custom,
     .start_token = Fy_TokenType_Int,
@@ -432,6 +692,111 @@ static const Fy_ParserParseRule Fy_parseRuleCmp = {
         .operator_id = Fy_BinaryOperator_Cmp
     }
 };
+static const Fy_ParserParseRule Fy_parseRuleAdc = {
+    .type = Fy_ParserParseRuleType_BinaryOperator,
+    .start_token = Fy_TokenType_Adc,
+    .as_binary = {
+        .operator_id = Fy_BinaryOperator_Adc
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleSbb = {
+    .type = Fy_ParserParseRuleType_BinaryOperator,
+    .start_token = Fy_TokenType_Sbb,
+    .as_binary = {
+        .operator_id = Fy_BinaryOperator_Sbb
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleAdd32 = {
+    .type = Fy_ParserParseRuleType_Operator32,
+    .start_token = Fy_TokenType_Add32,
+    .as_operator32 = {
+        .operator_id = Fy_BinaryOperator_Add
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleSub32 = {
+    .type = Fy_ParserParseRuleType_Operator32,
+    .start_token = Fy_TokenType_Sub32,
+    .as_operator32 = {
+        .operator_id = Fy_BinaryOperator_Sub
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleCmp32 = {
+    .type = Fy_ParserParseRuleType_Operator32,
+    .start_token = Fy_TokenType_Cmp32,
+    .as_operator32 = {
+        .operator_id = Fy_BinaryOperator_Cmp
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleShl32 = {
+    .type = Fy_ParserParseRuleType_Operator32,
+    .start_token = Fy_TokenType_Shl32,
+    .as_operator32 = {
+        .operator_id = Fy_BinaryOperator_Shl
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleShr32 = {
+    .type = Fy_ParserParseRuleType_Operator32,
+    .start_token = Fy_TokenType_Shr32,
+    .as_operator32 = {
+        .operator_id = Fy_BinaryOperator_Shr
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleFmov = {
+    .type = Fy_ParserParseRuleType_FpuOperator,
+    .start_token = Fy_TokenType_Fmov,
+    .as_fpu = {
+        .operator_id = Fy_FpuOperator_Mov
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleFadd = {
+    .type = Fy_ParserParseRuleType_FpuOperator,
+    .start_token = Fy_TokenType_Fadd,
+    .as_fpu = {
+        .operator_id = Fy_FpuOperator_Add
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleFsub = {
+    .type = Fy_ParserParseRuleType_FpuOperator,
+    .start_token = Fy_TokenType_Fsub,
+    .as_fpu = {
+        .operator_id = Fy_FpuOperator_Sub
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleFmul = {
+    .type = Fy_ParserParseRuleType_FpuOperator,
+    .start_token = Fy_TokenType_Fmul,
+    .as_fpu = {
+        .operator_id = Fy_FpuOperator_Mul
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleFdiv = {
+    .type = Fy_ParserParseRuleType_FpuOperator,
+    .start_token = Fy_TokenType_Fdiv,
+    .as_fpu = {
+        .operator_id = Fy_FpuOperator_Div
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleFcmp = {
+    .type = Fy_ParserParseRuleType_FpuOperator,
+    .start_token = Fy_TokenType_Fcmp,
+    .as_fpu = {
+        .operator_id = Fy_FpuOperator_Cmp
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleFsqrt = {
+    .type = Fy_ParserParseRuleType_FpuOperator,
+    .start_token = Fy_TokenType_Fsqrt,
+    .as_fpu = {
+        .operator_id = Fy_FpuOperator_Sqrt
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleFcvt = {
+    .type = Fy_ParserParseRuleType_FpuOperator,
+    .start_token = Fy_TokenType_Fcvt,
+    .as_fpu = {
+        .operator_id = Fy_FpuOperator_Cvt
+    }
+};
 static const Fy_ParserParseRule Fy_parseRuleNeg = {
     .type = Fy_ParserParseRuleType_UnaryOperator,
     .start_token = Fy_TokenType_Neg,
@@ -472,6 +837,84 @@ static const Fy_ParserParseRule Fy_parseRuleCbw = {
     }
 };
 
+static const Fy_ParserParseRule Fy_parseRuleIret = {
+    .type = Fy_ParserParseRuleType_Custom,
+    .start_token = Fy_TokenType_Iret,
+    .as_custom = {
+        .amount_params = 0,
+        .func_no_params = Fy_ParseIret,
+        .process_func = NULL,
+        .process_label_func = NULL,
+        .delete_func = NULL
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleMovsb = {
+    .type = Fy_ParserParseRuleType_Custom,
+    .start_token = Fy_TokenType_Movsb,
+    .as_custom = {
+        .amount_params = 0,
+        .func_no_params = Fy_ParseMovsb,
+        .process_func = NULL,
+        .process_label_func = NULL,
+        .delete_func = NULL
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleMovsw = {
+    .type = Fy_ParserParseRuleType_Custom,
+    .start_token = Fy_TokenType_Movsw,
+    .as_custom = {
+        .amount_params = 0,
+        .func_no_params = Fy_ParseMovsw,
+        .process_func = NULL,
+        .process_label_func = NULL,
+        .delete_func = NULL
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleStosb = {
+    .type = Fy_ParserParseRuleType_Custom,
+    .start_token = Fy_TokenType_Stosb,
+    .as_custom = {
+        .amount_params = 0,
+        .func_no_params = Fy_ParseStosb,
+        .process_func = NULL,
+        .process_label_func = NULL,
+        .delete_func = NULL
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleStosw = {
+    .type = Fy_ParserParseRuleType_Custom,
+    .start_token = Fy_TokenType_Stosw,
+    .as_custom = {
+        .amount_params = 0,
+        .func_no_params = Fy_ParseStosw,
+        .process_func = NULL,
+        .process_label_func = NULL,
+        .delete_func = NULL
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleCmpsb = {
+    .type = Fy_ParserParseRuleType_Custom,
+    .start_token = Fy_TokenType_Cmpsb,
+    .as_custom = {
+        .amount_params = 0,
+        .func_no_params = Fy_ParseCmpsb,
+        .process_func = NULL,
+        .process_label_func = NULL,
+        .delete_func = NULL
+    }
+};
+static const Fy_ParserParseRule Fy_parseRuleCmpsw = {
+    .type = Fy_ParserParseRuleType_Custom,
+    .start_token = Fy_TokenType_Cmpsw,
+    .as_custom = {
+        .amount_params = 0,
+        .func_no_params = Fy_ParseCmpsw,
+        .process_func = NULL,
+        .process_label_func = NULL,
+        .delete_func = NULL
+    }
+};
+
 /* Array that stores all rules (pointers to rules) */
 static const Fy_ParserParseRule* const Fy_parserRules[] = {
     &Fy_parseRuleNop,
@@ -484,6 +927,21 @@ static const Fy_ParserParseRule* const Fy_parserRules[] = {
     &Fy_parseRuleShl,
     &Fy_parseRuleShr,
     &Fy_parseRuleCmp,
+    &Fy_parseRuleAdc,
+    &Fy_parseRuleSbb,
+    &Fy_parseRuleAdd32,
+    &Fy_parseRuleSub32,
+    &Fy_parseRuleCmp32,
+    &Fy_parseRuleShl32,
+    &Fy_parseRuleShr32,
+    &Fy_parseRuleFmov,
+    &Fy_parseRuleFadd,
+    &Fy_parseRuleFsub,
+    &Fy_parseRuleFmul,
+    &Fy_parseRuleFdiv,
+    &Fy_parseRuleFcmp,
+    &Fy_parseRuleFsqrt,
+    &Fy_parseRuleFcvt,
     &Fy_parseRuleDebug,
     &Fy_parseRuleDebugStack,
     &Fy_parseRuleEnd,
@@ -500,6 +958,33 @@ static const Fy_ParserParseRule* const Fy_parserRules[] = {
     &Fy_parseRuleJle,
     &Fy_parseRuleJg,
     &Fy_parseRuleJge,
+    &Fy_parseRuleLoop,
+    &Fy_parseRuleLoopz,
+    &Fy_parseRuleLoopnz,
+    &Fy_parseRuleCmove,
+    &Fy_parseRuleCmovne,
+    &Fy_parseRuleCmovz,
+    &Fy_parseRuleCmovnz,
+    &Fy_parseRuleCmovb,
+    &Fy_parseRuleCmovbe,
+    &Fy_parseRuleCmova,
+    &Fy_parseRuleCmovae,
+    &Fy_parseRuleCmovl,
+    &Fy_parseRuleCmovle,
+    &Fy_parseRuleCmovg,
+    &Fy_parseRuleCmovge,
+    &Fy_parseRuleSete,
+    &Fy_parseRuleSetne,
+    &Fy_parseRuleSetz,
+    &Fy_parseRuleSetnz,
+    &Fy_parseRuleSetb,
+    &Fy_parseRuleSetbe,
+    &Fy_parseRuleSeta,
+    &Fy_parseRuleSetae,
+    &Fy_parseRuleSetl,
+    &Fy_parseRuleSetle,
+    &Fy_parseRuleSetg,
+    &Fy_parseRuleSetge,
     &Fy_parseRulePushConst,
     &Fy_parseRulePushReg16,
     &Fy_parseRulePop,
@@ -507,6 +992,7 @@ static const Fy_ParserParseRule* const Fy_parserRules[] = {
     &Fy_parseRuleRet,
     &Fy_parseRuleRetConst16,
     &Fy_parseRuleLea,
+    &Fy_parseRuleLeaLabel,
     &Fy_parseRuleInt,
     &Fy_parseRuleDivReg16,
     &Fy_parseRuleDivReg8,
@@ -520,7 +1006,14 @@ static const Fy_ParserParseRule* const Fy_parserRules[] = {
     &Fy_parseRuleInc,
     &Fy_parseRuleDec,
     &Fy_parseRuleNot,
-    &Fy_parseRuleCbw
+    &Fy_parseRuleCbw,
+    &Fy_parseRuleIret,
+    &Fy_parseRuleMovsb,
+    &Fy_parseRuleMovsw,
+    &Fy_parseRuleStosb,
+    &Fy_parseRuleStosw,
+    &Fy_parseRuleCmpsb,
+    &Fy_parseRuleCmpsw
 };
 
 /* Binary expression instruction rules */
@@ -537,6 +1030,16 @@ static const Fy_BinaryOperatorRule Fy_binaryOperatorRules[] = {
     { Fy_InstructionArgType_Memory8, Fy_InstructionArgType_Reg8, Fy_BinaryOperatorArgsType_Memory8Reg8 }
 };
 
+/* Three operand binary expression instruction rules */
+static const Fy_BinaryOperator3Rule Fy_binaryOperator3Rules[] = {
+    { Fy_InstructionArgType_Reg16, Fy_InstructionArgType_Reg16, Fy_InstructionArgType_Reg16, Fy_BinaryOperator3ArgsType_Reg16Reg16Reg16 },
+    { Fy_InstructionArgType_Reg16, Fy_InstructionArgType_Reg16, Fy_InstructionArgType_Const16, Fy_BinaryOperator3ArgsType_Reg16Reg16Const },
+    { Fy_InstructionArgType_Reg16, Fy_InstructionArgType_Reg16, Fy_InstructionArgType_Memory16, Fy_BinaryOperator3ArgsType_Reg16Reg16Memory16 },
+    { Fy_InstructionArgType_Reg8, Fy_InstructionArgType_Reg8, Fy_InstructionArgType_Reg8, Fy_BinaryOperator3ArgsType_Reg8Reg8Reg8 },
+    { Fy_InstructionArgType_Reg8, Fy_InstructionArgType_Reg8, Fy_InstructionArgType_Const8, Fy_BinaryOperator3ArgsType_Reg8Reg8Const },
+    { Fy_InstructionArgType_Reg8, Fy_InstructionArgType_Reg8, Fy_InstructionArgType_Memory8, Fy_BinaryOperator3ArgsType_Reg8Reg8Memory8 }
+};
+
 /* Unary expression instruction rules */
 static const Fy_UnaryOperatorRule Fy_unaryOperatorRules[] = {
     { Fy_InstructionArgType_Reg16, Fy_UnaryOperatorArgsType_Reg16 },
@@ -545,6 +1048,30 @@ static const Fy_UnaryOperatorRule Fy_unaryOperatorRules[] = {
     { Fy_InstructionArgType_Memory8, Fy_UnaryOperatorArgsType_Mem8 },
 };
 
+/* Instruction rules for the 32-bit operators, which always operate on dx:ax */
+static const Fy_Operator32Rule Fy_operator32Rules[] = {
+    { 1, Fy_InstructionArgType_Const16, 0, Fy_Operator32ArgsType_Const },
+    { 1, Fy_InstructionArgType_Memory32, 0, Fy_Operator32ArgsType_Memory32 },
+    { 2, Fy_InstructionArgType_Reg16, Fy_InstructionArgType_Reg16, Fy_Operator32ArgsType_Reg16Reg16 }
+};
+
+/* Instruction rules for the float register operators */
+static const Fy_FpuRule Fy_fpuRules[] = {
+    { Fy_InstructionArgType_RegFloat, Fy_InstructionArgType_RegFloat, Fy_FpuArgsType_RegFloatRegFloat },
+    { Fy_InstructionArgType_RegFloat, Fy_InstructionArgType_Memory32, Fy_FpuArgsType_RegFloatMemory32 },
+    { Fy_InstructionArgType_Memory32, Fy_InstructionArgType_RegFloat, Fy_FpuArgsType_Memory32RegFloat },
+    { Fy_InstructionArgType_RegFloat, Fy_InstructionArgType_Reg16, Fy_FpuArgsType_RegFloatReg16 },
+    { Fy_InstructionArgType_Reg16, Fy_InstructionArgType_RegFloat, Fy_FpuArgsType_Reg16RegFloat }
+};
+
+/* Instruction rules for cmovcc and setcc */
+static const Fy_ConditionalRule Fy_conditionalRules[] = {
+    { Fy_ConditionalOperation_Move, 2, Fy_InstructionArgType_Reg16, Fy_InstructionArgType_Reg16, Fy_ConditionalArgsType_Reg16Reg16 },
+    { Fy_ConditionalOperation_Move, 2, Fy_InstructionArgType_Reg16, Fy_InstructionArgType_Memory16, Fy_ConditionalArgsType_Reg16Memory16 },
+    { Fy_ConditionalOperation_Set, 1, Fy_InstructionArgType_Reg8, 0, Fy_ConditionalArgsType_Reg8 },
+    { Fy_ConditionalOperation_Set, 1, Fy_InstructionArgType_Memory8, 0, Fy_ConditionalArgsType_Memory8 }
+};
+
 /* Returns whether `type1` can be considered of type `type2` */
 static bool Fy_InstructionArgType_is(Fy_InstructionArgType type1, Fy_InstructionArgType type2) {
     if (type1 == type2)
@@ -553,6 +1080,8 @@ static bool Fy_InstructionArgType_is(Fy_InstructionArgType type1, Fy_Instruction
         return true;
     if (type1 == Fy_InstructionArgType_MemoryUnknownSize && type2 == Fy_InstructionArgType_Memory8)
         return true;
+    if (type1 == Fy_InstructionArgType_MemoryUnknownSize && type2 == Fy_InstructionArgType_Memory32)
+        return true;
     if (type1 == Fy_InstructionArgType_Const8 && type2 == Fy_InstructionArgType_Const16)
         return true;
     return false;
@@ -565,6 +1094,7 @@ static void Fy_InstructionArg_Destruct(Fy_InstructionArg *arg) {
         break;
     case Fy_InstructionArgType_Memory8:
     case Fy_InstructionArgType_Memory16:
+    case Fy_InstructionArgType_Memory32:
         Fy_AST_Delete(arg->as_memory);
         break;
     default:
@@ -840,6 +1370,34 @@ static Fy_Instruction *Fy_ParseCbw(Fy_Parser *parser) {
     return Fy_ParseOpNoParams(parser, &Fy_instructionTypeCbw);
 }
 
+static Fy_Instruction *Fy_ParseIret(Fy_Parser *parser) {
+    return Fy_ParseOpNoParams(parser, &Fy_instructionTypeIret);
+}
+
+static Fy_Instruction *Fy_ParseMovsb(Fy_Parser *parser) {
+    return Fy_ParseOpNoParams(parser, &Fy_instructionTypeMovsb);
+}
+
+static Fy_Instruction *Fy_ParseMovsw(Fy_Parser *parser) {
+    return Fy_ParseOpNoParams(parser, &Fy_instructionTypeMovsw);
+}
+
+static Fy_Instruction *Fy_ParseStosb(Fy_Parser *parser) {
+    return Fy_ParseOpNoParams(parser, &Fy_instructionTypeStosb);
+}
+
+static Fy_Instruction *Fy_ParseStosw(Fy_Parser *parser) {
+    return Fy_ParseOpNoParams(parser, &Fy_instructionTypeStosw);
+}
+
+static Fy_Instruction *Fy_ParseCmpsb(Fy_Parser *parser) {
+    return Fy_ParseOpNoParams(parser, &Fy_instructionTypeCmpsb);
+}
+
+static Fy_Instruction *Fy_ParseCmpsw(Fy_Parser *parser) {
+    return Fy_ParseOpNoParams(parser, &Fy_instructionTypeCmpsw);
+}
+
 static Fy_Instruction *Fy_ParseRetConst16(Fy_Parser *parser, Fy_InstructionArg *arg) {
     return Fy_ParseOpConst16(parser, arg, &Fy_instructionTypeRetConst16);
 }
@@ -906,18 +1464,35 @@ static Fy_Instruction *Fy_ParseLea(Fy_Parser *parser, Fy_InstructionArg *arg1, F
     return Fy_ParseOpReg16Mem(parser, arg1, arg2, &Fy_instructionTypeLea);
 }
 
+static Fy_Instruction *Fy_ParseLeaLabel(Fy_Parser *parser, Fy_InstructionArg *arg1, Fy_InstructionArg *arg2) {
+    Fy_Instruction_OpReg16Label *instruction = FY_INSTRUCTION_NEW(Fy_Instruction_OpReg16Label, Fy_instructionTypeLeaLabel);
+    (void)parser;
+    instruction->reg_id = arg1->as_reg16;
+    instruction->name = arg2->as_label;
+    return (Fy_Instruction*)instruction;
+}
+
 /* Processing functions */
 
-static void Fy_ProcessOpLabel(Fy_Parser *parser, Fy_Instruction_OpLabel *instruction) {
+/* Returns the index of the instruction a code label points to */
+static size_t Fy_Parser_getCodeLabel(Fy_Parser *parser, char *name) {
     Fy_BucketNode *node;
-    node = Fy_Symbolmap_getEntry(&parser->symmap, instruction->name);
+    node = Fy_Symbolmap_getEntry(&parser->symmap, name);
     if (!node) {
         // FIXME: This needs to have the right line and columns
-        Fy_Parser_error(parser, Fy_ParserError_SymbolNotFound, NULL, "%s", instruction->name);
+        Fy_Parser_error(parser, Fy_ParserError_SymbolNotFound, NULL, "%s", name);
     }
     if (node->type != Fy_MapEntryType_Label)
-        Fy_Parser_error(parser, Fy_ParserError_SymbolNotCode, NULL, "%s", instruction->name);
-    instruction->instruction_offset = node->code_label;
+        Fy_Parser_error(parser, Fy_ParserError_SymbolNotCode, NULL, "%s", name);
+    return node->code_label;
+}
+
+static void Fy_ProcessOpLabel(Fy_Parser *parser, Fy_Instruction_OpLabel *instruction) {
+    instruction->instruction_offset = Fy_Parser_getCodeLabel(parser, instruction->name);
+}
+
+static void Fy_ProcessOpReg16Label(Fy_Parser *parser, Fy_Instruction_OpReg16Label *instruction) {
+    instruction->instruction_offset = Fy_Parser_getCodeLabel(parser, instruction->name);
 }
 
 static void Fy_ProcessOpReg16Mem(Fy_Parser *parser, Fy_Instruction_OpReg16Mem *instruction) {
@@ -930,12 +1505,20 @@ static void Fy_ProcessLabelOpLabel(Fy_Parser *parser, Fy_Instruction_OpLabel *in
     instruction->address = Fy_Parser_getCodeOffsetByInstructionIndex(parser, instruction->instruction_offset);
 }
 
+static void Fy_ProcessLabelOpReg16Label(Fy_Parser *parser, Fy_Instruction_OpReg16Label *instruction) {
+    instruction->address = Fy_Parser_getCodeOffsetByInstructionIndex(parser, instruction->instruction_offset);
+}
+
 /* Custom delete functions */
 
 static void Fy_DeleteLea(Fy_Instruction_OpReg16Mem *instruction) {
     Fy_AST_Delete(instruction->address_ast);
 }
 
+static void Fy_DeleteLeaLabel(Fy_Instruction_OpReg16Label *instruction) {
+    free(instruction->name);
+}
+
 /* General parsing functions */
 
 static bool Fy_Parser_expectNewline(Fy_Parser *parser, bool do_error) {
@@ -980,6 +1563,9 @@ static bool Fy_Parser_parseArgument(Fy_Parser *parser, Fy_InstructionArg *out) {
         } else if (Fy_TokenType_isReg8(parser->token.type)) {
             out->type = Fy_InstructionArgType_Reg8;
             out->as_reg8 = Fy_TokenType_toReg8(parser->token.type);
+        } else if (Fy_TokenType_isRegFloat(parser->token.type)) {
+            out->type = Fy_InstructionArgType_RegFloat;
+            out->as_reg_float = Fy_TokenType_toRegFloat(parser->token.type);
         } else if (parser->token.type == Fy_TokenType_Symbol) {
             out->type = Fy_InstructionArgType_Label;
             out->as_label = Fy_Token_toLowercaseCStr(&parser->token);
@@ -1020,12 +1606,86 @@ static Fy_Instruction *Fy_Parser_parseByCustomRule(Fy_Parser *parser, const Fy_P
     return instruction;
 }
 
+static Fy_Instruction *Fy_Parser_parseByBinaryOperator3Rule(Fy_Parser *parser, const Fy_ParserParseRule *rule,
+                                                             Fy_InstructionArg *arg1, Fy_InstructionArg *arg2, Fy_InstructionArg *arg3,
+                                                             Fy_ParserState *start_state) {
+    Fy_Instruction_BinaryOperator3 *instruction;
+    Fy_BinaryOperator3ArgsType args_type;
+    size_t amount_matches = 0;
+
+    // Three operand forms don't make sense for operators that don't compute a new value from both sources
+    if (rule->as_binary.operator_id == Fy_BinaryOperator_Mov || rule->as_binary.operator_id == Fy_BinaryOperator_Cmp)
+        return NULL;
+
+    for (size_t i = 0; i < sizeof(Fy_binaryOperator3Rules) / sizeof(Fy_BinaryOperator3Rule); ++i) {
+        const Fy_BinaryOperator3Rule *binary3_rule = &Fy_binaryOperator3Rules[i];
+        if (Fy_InstructionArgType_is(arg1->type, binary3_rule->arg1_type) && Fy_InstructionArgType_is(arg2->type, binary3_rule->arg2_type)
+            && Fy_InstructionArgType_is(arg3->type, binary3_rule->arg3_type)) {
+            args_type = binary3_rule->binary3_instruction_type;
+            ++amount_matches;
+        }
+    }
+
+    switch (amount_matches) {
+    case 0:
+        return NULL;
+    case 1:
+        break;
+    default:
+        // Got more than 1 match
+        Fy_Parser_error(parser, Fy_ParserError_AmbiguousInstructionParameters, start_state, NULL);
+    }
+
+    instruction = FY_INSTRUCTION_NEW(Fy_Instruction_BinaryOperator3, Fy_instructionTypeBinaryOperator3);
+    instruction->operator = rule->as_binary.operator_id;
+    instruction->type = args_type;
+    switch (args_type) {
+    case Fy_BinaryOperator3ArgsType_Reg16Reg16Reg16:
+        instruction->as_reg16reg16reg16.reg_id = arg1->as_reg16;
+        instruction->as_reg16reg16reg16.reg2_id = arg2->as_reg16;
+        instruction->as_reg16reg16reg16.reg3_id = arg3->as_reg16;
+        break;
+    case Fy_BinaryOperator3ArgsType_Reg16Reg16Const:
+        instruction->as_reg16reg16const.reg_id = arg1->as_reg16;
+        instruction->as_reg16reg16const.reg2_id = arg2->as_reg16;
+        instruction->as_reg16reg16const.value = arg3->as_const;
+        break;
+    case Fy_BinaryOperator3ArgsType_Reg16Reg16Memory16:
+        instruction->as_reg16reg16mem16.reg_id = arg1->as_reg16;
+        instruction->as_reg16reg16mem16.reg2_id = arg2->as_reg16;
+        instruction->as_reg16reg16mem16.ast = arg3->as_memory;
+        break;
+    case Fy_BinaryOperator3ArgsType_Reg8Reg8Reg8:
+        instruction->as_reg8reg8reg8.reg_id = arg1->as_reg8;
+        instruction->as_reg8reg8reg8.reg2_id = arg2->as_reg8;
+        instruction->as_reg8reg8reg8.reg3_id = arg3->as_reg8;
+        break;
+    case Fy_BinaryOperator3ArgsType_Reg8Reg8Const:
+        instruction->as_reg8reg8const.reg_id = arg1->as_reg8;
+        instruction->as_reg8reg8const.reg2_id = arg2->as_reg8;
+        instruction->as_reg8reg8const.value = arg3->as_const;
+        break;
+    case Fy_BinaryOperator3ArgsType_Reg8Reg8Memory8:
+        instruction->as_reg8reg8mem8.reg_id = arg1->as_reg8;
+        instruction->as_reg8reg8mem8.reg2_id = arg2->as_reg8;
+        instruction->as_reg8reg8mem8.ast = arg3->as_memory;
+        break;
+    default:
+        FY_UNREACHABLE();
+    }
+
+    return (Fy_Instruction*)instruction;
+}
+
 static Fy_Instruction *Fy_Parser_parseByBinaryOperatorRule(Fy_Parser *parser, const Fy_ParserParseRule *rule, uint8_t amount_args,
-                                                            Fy_InstructionArg *arg1, Fy_InstructionArg *arg2, Fy_ParserState *start_state) {
+                                                            Fy_InstructionArg *arg1, Fy_InstructionArg *arg2, Fy_InstructionArg *arg3,
+                                                            Fy_ParserState *start_state) {
     Fy_Instruction_BinaryOperator *instruction;
     Fy_BinaryOperatorArgsType args_type;
     size_t amount_matches = 0;
 
+    if (amount_args == 3)
+        return Fy_Parser_parseByBinaryOperator3Rule(parser, rule, arg1, arg2, arg3, start_state);
     if (amount_args != 2)
         return NULL;
 
@@ -1153,6 +1813,192 @@ static Fy_Instruction *Fy_Parser_parseByUnaryOperatorRule(Fy_Parser *parser, con
     return (Fy_Instruction*)instruction;
 }
 
+static Fy_Instruction *Fy_Parser_parseByOperator32Rule(Fy_Parser *parser, const Fy_ParserParseRule *rule, uint8_t amount_args,
+                                                        Fy_InstructionArg *arg1, Fy_InstructionArg *arg2, Fy_ParserState *start_state) {
+    Fy_Instruction_Operator32 *instruction;
+    Fy_Operator32ArgsType args_type;
+    size_t amount_matches = 0;
+
+    // Decide how we handle the instruction arguments
+
+    for (size_t i = 0; i < sizeof(Fy_operator32Rules) / sizeof(Fy_Operator32Rule); ++i) {
+        const Fy_Operator32Rule *operator32_rule = &Fy_operator32Rules[i];
+        if (amount_args != operator32_rule->amount_args)
+            continue;
+        if (!Fy_InstructionArgType_is(arg1->type, operator32_rule->arg1_type))
+            continue;
+        if (amount_args == 2 && !Fy_InstructionArgType_is(arg2->type, operator32_rule->arg2_type))
+            continue;
+        args_type = operator32_rule->operator32_instruction_type;
+        ++amount_matches;
+    }
+
+    switch (amount_matches) {
+    case 0:
+        return NULL;
+    case 1:
+        break;
+    default:
+        // Got more than 1 match
+        Fy_Parser_error(parser, Fy_ParserError_AmbiguousInstructionParameters, start_state, NULL);
+    }
+
+    instruction = FY_INSTRUCTION_NEW(Fy_Instruction_Operator32, Fy_instructionTypeOperator32);
+    instruction->operator = rule->as_operator32.operator_id;
+    instruction->type = args_type;
+    switch (args_type) {
+    case Fy_Operator32ArgsType_Const:
+        // Constants are 16-bit, so they are zero extended
+        instruction->as_const = arg1->as_const;
+        break;
+    case Fy_Operator32ArgsType_Reg16Reg16:
+        instruction->as_reg16reg16.high_reg_id = arg1->as_reg16;
+        instruction->as_reg16reg16.low_reg_id = arg2->as_reg16;
+        break;
+    case Fy_Operator32ArgsType_Memory32:
+        instruction->as_mem32.ast = arg1->as_memory;
+        break;
+    default:
+        FY_UNREACHABLE();
+    }
+
+    return (Fy_Instruction*)instruction;
+}
+
+static Fy_Instruction *Fy_Parser_parseByConditionalRule(Fy_Parser *parser, const Fy_ParserParseRule *rule, uint8_t amount_args,
+                                                         Fy_InstructionArg *arg1, Fy_InstructionArg *arg2, Fy_ParserState *start_state) {
+    Fy_Instruction_Conditional *instruction;
+    Fy_ConditionalArgsType args_type;
+    size_t amount_matches = 0;
+
+    for (size_t i = 0; i < sizeof(Fy_conditionalRules) / sizeof(Fy_ConditionalRule); ++i) {
+        const Fy_ConditionalRule *conditional_rule = &Fy_conditionalRules[i];
+        if (rule->as_conditional.operation != conditional_rule->operation)
+            continue;
+        if (amount_args != conditional_rule->amount_args)
+            continue;
+        if (!Fy_InstructionArgType_is(arg1->type, conditional_rule->arg1_type))
+            continue;
+        if (amount_args == 2 && !Fy_InstructionArgType_is(arg2->type, conditional_rule->arg2_type))
+            continue;
+        args_type = conditional_rule->conditional_instruction_type;
+        ++amount_matches;
+    }
+
+    switch (amount_matches) {
+    case 0:
+        return NULL;
+    case 1:
+        break;
+    default:
+        // Got more than 1 match
+        Fy_Parser_error(parser, Fy_ParserError_AmbiguousInstructionParameters, start_state, NULL);
+    }
+
+    instruction = FY_INSTRUCTION_NEW(Fy_Instruction_Conditional, Fy_instructionTypeConditional);
+    instruction->condition = rule->as_conditional.condition;
+    instruction->type = args_type;
+    switch (args_type) {
+    case Fy_ConditionalArgsType_Reg16Reg16:
+        instruction->as_reg16reg16.reg_id = arg1->as_reg16;
+        instruction->as_reg16reg16.reg2_id = arg2->as_reg16;
+        break;
+    case Fy_ConditionalArgsType_Reg16Memory16:
+        instruction->as_reg16mem16.reg_id = arg1->as_reg16;
+        instruction->as_reg16mem16.ast = arg2->as_memory;
+        break;
+    case Fy_ConditionalArgsType_Reg8:
+        instruction->as_reg8 = arg1->as_reg8;
+        break;
+    case Fy_ConditionalArgsType_Memory8:
+        instruction->as_mem8.ast = arg1->as_memory;
+        break;
+    default:
+        FY_UNREACHABLE();
+    }
+
+    return (Fy_Instruction*)instruction;
+}
+
+/* Returns whether an FPU operator can take the given kind of arguments */
+static bool Fy_FpuOperator_accepts(Fy_FpuOperator operator, Fy_FpuArgsType args_type) {
+    switch (args_type) {
+    case Fy_FpuArgsType_RegFloatRegFloat:
+    case Fy_FpuArgsType_RegFloatMemory32:
+        return operator != Fy_FpuOperator_Cvt;
+    case Fy_FpuArgsType_Memory32RegFloat:
+        return operator == Fy_FpuOperator_Mov;
+    case Fy_FpuArgsType_RegFloatReg16:
+    case Fy_FpuArgsType_Reg16RegFloat:
+        return operator == Fy_FpuOperator_Cvt;
+    default:
+        FY_UNREACHABLE();
+        return false;
+    }
+}
+
+static Fy_Instruction *Fy_Parser_parseByFpuOperatorRule(Fy_Parser *parser, const Fy_ParserParseRule *rule, uint8_t amount_args,
+                                                         Fy_InstructionArg *arg1, Fy_InstructionArg *arg2, Fy_ParserState *start_state) {
+    Fy_Instruction_FpuOperator *instruction;
+    Fy_FpuArgsType args_type;
+    size_t amount_matches = 0;
+
+    if (amount_args != 2)
+        return NULL;
+
+    for (size_t i = 0; i < sizeof(Fy_fpuRules) / sizeof(Fy_FpuRule); ++i) {
+        const Fy_FpuRule *fpu_rule = &Fy_fpuRules[i];
+        if (!Fy_FpuOperator_accepts(rule->as_fpu.operator_id, fpu_rule->fpu_instruction_type))
+            continue;
+        if (!Fy_InstructionArgType_is(arg1->type, fpu_rule->arg1_type))
+            continue;
+        if (!Fy_InstructionArgType_is(arg2->type, fpu_rule->arg2_type))
+            continue;
+        args_type = fpu_rule->fpu_instruction_type;
+        ++amount_matches;
+    }
+
+    switch (amount_matches) {
+    case 0:
+        return NULL;
+    case 1:
+        break;
+    default:
+        // Got more than 1 match
+        Fy_Parser_error(parser, Fy_ParserError_AmbiguousInstructionParameters, start_state, NULL);
+    }
+
+    instruction = FY_INSTRUCTION_NEW(Fy_Instruction_FpuOperator, Fy_instructionTypeFpuOperator);
+    instruction->operator = rule->as_fpu.operator_id;
+    instruction->type = args_type;
+    switch (args_type) {
+    case Fy_FpuArgsType_RegFloatRegFloat:
+        instruction->as_regs.reg_id = arg1->as_reg_float;
+        instruction->as_regs.reg2_id = arg2->as_reg_float;
+        break;
+    case Fy_FpuArgsType_RegFloatMemory32:
+        instruction->as_mem32.reg_id = arg1->as_reg_float;
+        instruction->as_mem32.ast = arg2->as_memory;
+        break;
+    case Fy_FpuArgsType_Memory32RegFloat:
+        instruction->as_mem32.reg_id = arg2->as_reg_float;
+        instruction->as_mem32.ast = arg1->as_memory;
+        break;
+    case Fy_FpuArgsType_RegFloatReg16:
+        instruction->as_regs.reg_id = arg1->as_reg_float;
+        instruction->as_regs.reg2_id = arg2->as_reg16;
+        break;
+    case Fy_FpuArgsType_Reg16RegFloat:
+        instruction->as_regs.reg_id = arg1->as_reg16;
+        instruction->as_regs.reg2_id = arg2->as_reg_float;
+        break;
+    default:
+        FY_UNREACHABLE();
+    }
+
+    return (Fy_Instruction*)instruction;
+}
+
 static Fy_Instruction *Fy_Parser_parseByJumpRule(Fy_Parser *parser, const Fy_ParserParseRule *rule, uint8_t amount_args,
                                                 Fy_InstructionArg *arg1, Fy_InstructionArg *arg2) {
     Fy_Instruction_OpLabel *instruction;
@@ -1176,7 +2022,7 @@ static Fy_Instruction *Fy_Parser_parseInstruction(Fy_Parser *parser) {
     Fy_ParserState start_backtrack;
     Fy_TokenType start_token;
     uint8_t amount_args;
-    Fy_InstructionArg arg1, arg2;
+    Fy_InstructionArg arg1, arg2, arg3;
     const Fy_ParserParseRule *rule, *parsedRule;
     Fy_Instruction *instruction = NULL;
 
@@ -1190,8 +2036,11 @@ static Fy_Instruction *Fy_Parser_parseInstruction(Fy_Parser *parser) {
     amount_args = 0;
     if (Fy_Parser_parseArgument(parser, &arg1)) {
         ++amount_args;
-        if (Fy_Parser_parseArgument(parser, &arg2))
+        if (Fy_Parser_parseArgument(parser, &arg2)) {
             ++amount_args;
+            if (Fy_Parser_parseArgument(parser, &arg3))
+                ++amount_args;
+        }
     }
     Fy_Parser_expectNewline(parser, true);
 
@@ -1206,7 +2055,7 @@ static Fy_Instruction *Fy_Parser_parseInstruction(Fy_Parser *parser) {
                 new_instruction = Fy_Parser_parseByCustomRule(parser, rule, amount_args, &arg1, &arg2);
                 break;
             case Fy_ParserParseRuleType_BinaryOperator:
-                new_instruction = Fy_Parser_parseByBinaryOperatorRule(parser, rule, amount_args, &arg1, &arg2, &start_backtrack);
+                new_instruction = Fy_Parser_parseByBinaryOperatorRule(parser, rule, amount_args, &arg1, &arg2, &arg3, &start_backtrack);
                 break;
             case Fy_ParserParseRuleType_UnaryOperator:
                 new_instruction = Fy_Parser_parseByUnaryOperatorRule(parser, rule, amount_args, &arg1, &arg2, &start_backtrack);
@@ -1214,6 +2063,15 @@ static Fy_Instruction *Fy_Parser_parseInstruction(Fy_Parser *parser) {
             case Fy_ParserParseRuleType_Jump:
                 new_instruction = Fy_Parser_parseByJumpRule(parser, rule, amount_args, &arg1, &arg2);
                 break;
+            case Fy_ParserParseRuleType_Operator32:
+                new_instruction = Fy_Parser_parseByOperator32Rule(parser, rule, amount_args, &arg1, &arg2, &start_backtrack);
+                break;
+            case Fy_ParserParseRuleType_FpuOperator:
+                new_instruction = Fy_Parser_parseByFpuOperatorRule(parser, rule, amount_args, &arg1, &arg2, &start_backtrack);
+                break;
+            case Fy_ParserParseRuleType_Conditional:
+                new_instruction = Fy_Parser_parseByConditionalRule(parser, rule, amount_args, &arg1, &arg2, &start_backtrack);
+                break;
             default:
                 FY_UNREACHABLE();
             }
@@ -1247,6 +2105,11 @@ static Fy_Instruction *Fy_Parser_parseInstruction(Fy_Parser *parser) {
         Fy_InstructionArg_Destruct(&arg1);
         Fy_InstructionArg_Destruct(&arg2);
         break;
+    case 3:
+        Fy_InstructionArg_Destruct(&arg1);
+        Fy_InstructionArg_Destruct(&arg2);
+        Fy_InstructionArg_Destruct(&arg3);
+        break;
     default:
         FY_UNREACHABLE();
     }
@@ -1567,6 +2430,25 @@ static void Fy_Parser_readInstructions(Fy_Parser *parser) {
     }
 }
 
+/* Evaluates the memory AST of a three operand instruction with a memory source */
+static void Fy_Parser_processBinaryOperator3(Fy_Parser *parser, Fy_Instruction_BinaryOperator3 *instruction) {
+    switch (instruction->type) {
+    case Fy_BinaryOperator3ArgsType_Reg16Reg16Reg16:
+    case Fy_BinaryOperator3ArgsType_Reg16Reg16Const:
+    case Fy_BinaryOperator3ArgsType_Reg8Reg8Reg8:
+    case Fy_BinaryOperator3ArgsType_Reg8Reg8Const:
+        break;
+    case Fy_BinaryOperator3ArgsType_Reg16Reg16Memory16:
+        Fy_AST_eval(instruction->as_reg16reg16mem16.ast, parser, &instruction->as_reg16reg16mem16.address);
+        break;
+    case Fy_BinaryOperator3ArgsType_Reg8Reg8Memory8:
+        Fy_AST_eval(instruction->as_reg8reg8mem8.ast, parser, &instruction->as_reg8reg8mem8.address);
+        break;
+    default:
+        FY_UNREACHABLE();
+    }
+}
+
 /* Step 2: processing parsed instructions */
 static void Fy_Parser_processInstructions(Fy_Parser *parser) {
     for (size_t i = 0; i < parser->amount_used; ++i) {
@@ -1579,6 +2461,10 @@ static void Fy_Parser_processInstructions(Fy_Parser *parser) {
             break;
         case Fy_ParserParseRuleType_BinaryOperator: {
             Fy_Instruction_BinaryOperator *binary_instruction = (Fy_Instruction_BinaryOperator*)instruction;
+            if (instruction->type == &Fy_instructionTypeBinaryOperator3) {
+                Fy_Parser_processBinaryOperator3(parser, (Fy_Instruction_BinaryOperator3*)instruction);
+                break;
+            }
             // Evaluate memory AST in instructions that reference memory
             switch (binary_instruction->type) {
             case Fy_BinaryOperatorArgsType_Reg16Const:
@@ -1630,6 +2516,26 @@ static void Fy_Parser_processInstructions(Fy_Parser *parser) {
         case Fy_ParserParseRuleType_Jump:
             Fy_ProcessOpLabel(parser, (Fy_Instruction_OpLabel*)instruction);
             break;
+        case Fy_ParserParseRuleType_Operator32: {
+            Fy_Instruction_Operator32 *operator32_instruction = (Fy_Instruction_Operator32*)instruction;
+            if (operator32_instruction->type == Fy_Operator32ArgsType_Memory32)
+                Fy_AST_eval(operator32_instruction->as_mem32.ast, parser, &operator32_instruction->as_mem32.address);
+            break;
+        }
+        case Fy_ParserParseRuleType_FpuOperator: {
+            Fy_Instruction_FpuOperator *fpu_instruction = (Fy_Instruction_FpuOperator*)instruction;
+            if (fpu_instruction->type == Fy_FpuArgsType_RegFloatMemory32 || fpu_instruction->type == Fy_FpuArgsType_Memory32RegFloat)
+                Fy_AST_eval(fpu_instruction->as_mem32.ast, parser, &fpu_instruction->as_mem32.address);
+            break;
+        }
+        case Fy_ParserParseRuleType_Conditional: {
+            Fy_Instruction_Conditional *conditional_instruction = (Fy_Instruction_Conditional*)instruction;
+            if (conditional_instruction->type == Fy_ConditionalArgsType_Reg16Memory16)
+                Fy_AST_eval(conditional_instruction->as_reg16mem16.ast, parser, &conditional_instruction->as_reg16mem16.address);
+            else if (conditional_instruction->type == Fy_ConditionalArgsType_Memory8)
+                Fy_AST_eval(conditional_instruction->as_mem8.ast, parser, &conditional_instruction->as_mem8.address);
+            break;
+        }
         default:
             FY_UNREACHABLE();
         }
@@ -1676,10 +2582,13 @@ static void Fy_Parser_processLabels(Fy_Parser *parser) {
         switch (instruction->parse_rule->type) {
         case Fy_ParserParseRuleType_Custom:
             if (instruction->parse_rule->as_custom.process_label_func)
-                instruction->parse_rule->as_custom.process_label_func(instruction, parser);
+                instruction->parse_rule->as_custom.process_label_func(parser, instruction);
             break;
         case Fy_ParserParseRuleType_BinaryOperator:
         case Fy_ParserParseRuleType_UnaryOperator:
+        case Fy_ParserParseRuleType_Operator32:
+        case Fy_ParserParseRuleType_Conditional:
+        case Fy_ParserParseRuleType_FpuOperator:
             break;
         case Fy_ParserParseRuleType_Jump:
             Fy_ProcessLabelOpLabel(parser, (Fy_Instruction_OpLabel*)instruction);
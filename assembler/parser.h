@@ -21,9 +21,12 @@ typedef enum Fy_ParserParseRuleType Fy_ParserParseRuleType;
 typedef struct Fy_AST Fy_AST;
 typedef enum Fy_BinaryOperator Fy_BinaryOperator;
 typedef enum Fy_UnaryOperator Fy_UnaryOperator;
+typedef enum Fy_Condition Fy_Condition;
+typedef enum Fy_ConditionalOperation Fy_ConditionalOperation;
+typedef enum Fy_FpuOperator Fy_FpuOperator;
 typedef struct Fy_ParserParseRule Fy_ParserParseRule;
 typedef void (*Fy_InstructionProcessFunc)(Fy_Parser*, Fy_Instruction*);
-typedef void (*Fy_InstructionProcessLabelFunc)(Fy_Instruction*, Fy_Parser*);
+typedef void (*Fy_InstructionProcessLabelFunc)(Fy_Parser*, Fy_Instruction*);
 typedef void (*Fy_InstructionCustomDeleteFunc)(Fy_Instruction*);
 
 struct Fy_ParserState {
@@ -81,7 +84,9 @@ enum Fy_InstructionArgType {
     Fy_InstructionArgType_Label,
     Fy_InstructionArgType_MemoryUnknownSize,
     Fy_InstructionArgType_Memory16,
-    Fy_InstructionArgType_Memory8
+    Fy_InstructionArgType_Memory8,
+    Fy_InstructionArgType_Memory32,
+    Fy_InstructionArgType_RegFloat
 };
 
 struct Fy_InstructionArg {
@@ -90,6 +95,7 @@ struct Fy_InstructionArg {
     union {
         uint8_t as_reg16;
         uint8_t as_reg8;
+        uint8_t as_reg_float;
         /* NOTE: as_const is used for both const16 and const8, the type only indicates the maximum size of the constant */
         uint16_t as_const;
         char *as_label;
@@ -106,7 +112,9 @@ enum Fy_BinaryOperator {
     Fy_BinaryOperator_Xor,
     Fy_BinaryOperator_Shl,
     Fy_BinaryOperator_Shr,
-    Fy_BinaryOperator_Cmp
+    Fy_BinaryOperator_Cmp,
+    Fy_BinaryOperator_Adc,
+    Fy_BinaryOperator_Sbb
 };
 
 enum Fy_UnaryOperator {
@@ -116,11 +124,46 @@ enum Fy_UnaryOperator {
     Fy_UnaryOperator_Not
 };
 
+/* Flag conditions shared by the conditional jumps, cmovcc and setcc */
+enum Fy_Condition {
+    Fy_Condition_E = 1,
+    Fy_Condition_Ne,
+    Fy_Condition_B,
+    Fy_Condition_Be,
+    Fy_Condition_A,
+    Fy_Condition_Ae,
+    Fy_Condition_L,
+    Fy_Condition_Le,
+    Fy_Condition_G,
+    Fy_Condition_Ge
+};
+
+/* Operators on the float registers, the first operand is always the destination */
+enum Fy_FpuOperator {
+    Fy_FpuOperator_Mov = 1,
+    Fy_FpuOperator_Add,
+    Fy_FpuOperator_Sub,
+    Fy_FpuOperator_Mul,
+    Fy_FpuOperator_Div,
+    Fy_FpuOperator_Cmp,
+    Fy_FpuOperator_Sqrt,
+    /* Converts between a float register and a signed 16-bit register */
+    Fy_FpuOperator_Cvt
+};
+
+enum Fy_ConditionalOperation {
+    Fy_ConditionalOperation_Move = 1,
+    Fy_ConditionalOperation_Set
+};
+
 enum Fy_ParserParseRuleType {
     Fy_ParserParseRuleType_Custom = 1,
     Fy_ParserParseRuleType_BinaryOperator,
     Fy_ParserParseRuleType_UnaryOperator,
-    Fy_ParserParseRuleType_Jump
+    Fy_ParserParseRuleType_Jump,
+    Fy_ParserParseRuleType_Operator32,
+    Fy_ParserParseRuleType_Conditional,
+    Fy_ParserParseRuleType_FpuOperator
 };
 
 struct Fy_ParserParseRule {
@@ -147,6 +190,17 @@ struct Fy_ParserParseRule {
         struct {
             Fy_UnaryOperator operator_id;
         } as_unary;
+        struct {
+            /* Only add, sub, cmp, shl and shr are supported on dx:ax */
+            Fy_BinaryOperator operator_id;
+        } as_operator32;
+        struct {
+            Fy_ConditionalOperation operation;
+            Fy_Condition condition;
+        } as_conditional;
+        struct {
+            Fy_FpuOperator operator_id;
+        } as_fpu;
         struct {
             const Fy_InstructionType *instruction_type;
         } as_jump;
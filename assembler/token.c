@@ -6,7 +6,17 @@ Fy_TokenType Fy_reg16Tokens[] = {
     Fy_TokenType_Cx,
     Fy_TokenType_Dx,
     Fy_TokenType_Sp,
-    Fy_TokenType_Bp
+    Fy_TokenType_Bp,
+    Fy_TokenType_Si,
+    Fy_TokenType_Di,
+    Fy_TokenType_R8,
+    Fy_TokenType_R9,
+    Fy_TokenType_R10,
+    Fy_TokenType_R11,
+    Fy_TokenType_R12,
+    Fy_TokenType_R13,
+    Fy_TokenType_R14,
+    Fy_TokenType_R15
 };
 
 Fy_TokenType Fy_reg8Tokens[] = {
@@ -75,11 +85,41 @@ Fy_Reg16 Fy_TokenType_toReg16(Fy_TokenType type) {
         return Fy_Reg16_Sp;
     case Fy_TokenType_Bp:
         return Fy_Reg16_Bp;
+    case Fy_TokenType_Si:
+        return Fy_Reg16_Si;
+    case Fy_TokenType_Di:
+        return Fy_Reg16_Di;
+    case Fy_TokenType_R8:
+        return Fy_Reg16_R8;
+    case Fy_TokenType_R9:
+        return Fy_Reg16_R9;
+    case Fy_TokenType_R10:
+        return Fy_Reg16_R10;
+    case Fy_TokenType_R11:
+        return Fy_Reg16_R11;
+    case Fy_TokenType_R12:
+        return Fy_Reg16_R12;
+    case Fy_TokenType_R13:
+        return Fy_Reg16_R13;
+    case Fy_TokenType_R14:
+        return Fy_Reg16_R14;
+    case Fy_TokenType_R15:
+        return Fy_Reg16_R15;
     default:
         FY_UNREACHABLE();
     }
 }
 
+bool Fy_TokenType_isRegFloat(Fy_TokenType type) {
+    return type >= Fy_TokenType_F0 && type <= Fy_TokenType_F7;
+}
+
+Fy_RegFloat Fy_TokenType_toRegFloat(Fy_TokenType type) {
+    assert(Fy_TokenType_isRegFloat(type));
+    // The float register tokens are declared in order
+    return (Fy_RegFloat)(type - Fy_TokenType_F0);
+}
+
 static size_t char_to_number(char c) {
     if (c >= '0' && c <= '9')
         return c - '0';
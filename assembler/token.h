@@ -23,6 +23,21 @@ typedef enum Fy_TokenType {
     Fy_TokenType_Shl,
     Fy_TokenType_Shr,
     Fy_TokenType_Cmp,
+    Fy_TokenType_Adc,
+    Fy_TokenType_Sbb,
+    Fy_TokenType_Add32,
+    Fy_TokenType_Sub32,
+    Fy_TokenType_Cmp32,
+    Fy_TokenType_Shl32,
+    Fy_TokenType_Shr32,
+    Fy_TokenType_Fmov,
+    Fy_TokenType_Fadd,
+    Fy_TokenType_Fsub,
+    Fy_TokenType_Fmul,
+    Fy_TokenType_Fdiv,
+    Fy_TokenType_Fcmp,
+    Fy_TokenType_Fsqrt,
+    Fy_TokenType_Fcvt,
     Fy_TokenType_Div,
     Fy_TokenType_Idiv,
     Fy_TokenType_Mul,
@@ -32,6 +47,12 @@ typedef enum Fy_TokenType {
     Fy_TokenType_Dec,
     Fy_TokenType_Not,
     Fy_TokenType_Cbw,
+    Fy_TokenType_Movsb,
+    Fy_TokenType_Movsw,
+    Fy_TokenType_Stosb,
+    Fy_TokenType_Stosw,
+    Fy_TokenType_Cmpsb,
+    Fy_TokenType_Cmpsw,
     Fy_TokenType_Debug,
     Fy_TokenType_DebugStack,
     Fy_TokenType_Jmp,
@@ -47,8 +68,36 @@ typedef enum Fy_TokenType {
     Fy_TokenType_Jle,
     Fy_TokenType_Jg,
     Fy_TokenType_Jge,
+    Fy_TokenType_Loop,
+    Fy_TokenType_Loopz,
+    Fy_TokenType_Loopnz,
+    Fy_TokenType_Cmove,
+    Fy_TokenType_Cmovne,
+    Fy_TokenType_Cmovz,
+    Fy_TokenType_Cmovnz,
+    Fy_TokenType_Cmovb,
+    Fy_TokenType_Cmovbe,
+    Fy_TokenType_Cmova,
+    Fy_TokenType_Cmovae,
+    Fy_TokenType_Cmovl,
+    Fy_TokenType_Cmovle,
+    Fy_TokenType_Cmovg,
+    Fy_TokenType_Cmovge,
+    Fy_TokenType_Sete,
+    Fy_TokenType_Setne,
+    Fy_TokenType_Setz,
+    Fy_TokenType_Setnz,
+    Fy_TokenType_Setb,
+    Fy_TokenType_Setbe,
+    Fy_TokenType_Seta,
+    Fy_TokenType_Setae,
+    Fy_TokenType_Setl,
+    Fy_TokenType_Setle,
+    Fy_TokenType_Setg,
+    Fy_TokenType_Setge,
     Fy_TokenType_Call,
     Fy_TokenType_Ret,
+    Fy_TokenType_Iret,
     Fy_TokenType_Push,
     Fy_TokenType_Pop,
     Fy_TokenType_Int,
@@ -59,6 +108,16 @@ typedef enum Fy_TokenType {
     Fy_TokenType_Dx,
     Fy_TokenType_Sp,
     Fy_TokenType_Bp,
+    Fy_TokenType_Si,
+    Fy_TokenType_Di,
+    Fy_TokenType_R8,
+    Fy_TokenType_R9,
+    Fy_TokenType_R10,
+    Fy_TokenType_R11,
+    Fy_TokenType_R12,
+    Fy_TokenType_R13,
+    Fy_TokenType_R14,
+    Fy_TokenType_R15,
     Fy_TokenType_Ah,
     Fy_TokenType_Al,
     Fy_TokenType_Bh,
@@ -67,6 +126,14 @@ typedef enum Fy_TokenType {
     Fy_TokenType_Cl,
     Fy_TokenType_Dh,
     Fy_TokenType_Dl,
+    Fy_TokenType_F0,
+    Fy_TokenType_F1,
+    Fy_TokenType_F2,
+    Fy_TokenType_F3,
+    Fy_TokenType_F4,
+    Fy_TokenType_F5,
+    Fy_TokenType_F6,
+    Fy_TokenType_F7,
     Fy_TokenType_Proc,
     Fy_TokenType_Endp,
     Fy_TokenType_Symbol,
@@ -79,6 +146,7 @@ typedef enum Fy_TokenType {
     Fy_TokenType_RightParen,
     Fy_TokenType_Byte,
     Fy_TokenType_Word,
+    Fy_TokenType_Dword,
     Fy_TokenType_Plus,
     Fy_TokenType_Minus,
     Fy_TokenType_Star,
@@ -106,6 +174,8 @@ bool Fy_TokenType_isReg8(Fy_TokenType type);
 bool Fy_TokenType_isReg16(Fy_TokenType type);
 Fy_Reg8 Fy_TokenType_toReg8(Fy_TokenType type);
 Fy_Reg16 Fy_TokenType_toReg16(Fy_TokenType type);
+bool Fy_TokenType_isRegFloat(Fy_TokenType type);
+Fy_RegFloat Fy_TokenType_toRegFloat(Fy_TokenType type);
 char *Fy_Token_toLowercaseCStr(Fy_Token *token);
 
 #endif /* FY_TOKEN_H */
@@ -29,8 +29,7 @@ calculate:
     mov ax [a] ; load a
     mov bx [b] ; load b
     ; create next
-    mov cx ax
-    add cx bx
+    add cx ax bx
 
     mov dx [n]
     sub dx 1
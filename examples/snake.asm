@@ -28,10 +28,11 @@ DATA
     string_points eb " points", 10, 0
 CODE
 start: ; This is currently not needed
-    ; Initialize screen
-    mov ah CUBE_SIZE * CUBES_WIDTH
-    mov al CUBE_SIZE * CUBES_HEIGHT
-    int 3
+    ; Initialize screen, every pixel is shown as a whole cube
+    mov ax CUBES_WIDTH
+    mov bx CUBES_HEIGHT
+    mov cx CUBE_SIZE
+    int 48
 
     call generate_apple
     call move_snake
@@ -43,6 +44,9 @@ start: ; This is currently not needed
     mov [new_dir_y] al
 
 mainloop:
+    ; Block until a key is pressed or 10ms pass instead of spinning
+    mov ax 10
+    int 10
     int 7 ; Get USB scancode
     cmp ax 0
     je end_check_press
@@ -186,7 +190,7 @@ enough_time_elapsed:
     ret
 endp has_enough_time_elapsed
 
-; Draw a rectangle of a constant size on the screen
+; Draw a cube on the screen
 x = bp + 4
 y = bp + 5
 color = bp + 6
@@ -195,45 +199,12 @@ proc draw_cube
     mov bp sp
     push ax
     push bx
-    push cx
-
-    ; Calculate actual x
-    mov al [x]
-    mov bl CUBE_SIZE
-    mul bl
-    mov [x] al
-
-    ; Calculate actual y
-    mov al [y]
-    mov bl CUBE_SIZE
-    mul bl
-    mov [y] al
 
-    mov bx [color]
-
-    mov ch 0
-draw_y_times:
-
-    mov cl 0
-draw_width_line:
-    ; X for call
     mov ah [x]
-    add ah cl
-    ; Y for call
     mov al [y]
-    add al ch
-    ; Color for call
+    mov bl [color]
     int 4 ; Draw pixel
 
-    inc cl
-    cmp cl CUBE_SIZE
-    jb draw_width_line
-
-    inc ch
-    cmp ch CUBE_SIZE
-    jb draw_y_times
-
-    pop cx
     pop bx
     pop ax
     pop bp
@@ -315,6 +286,7 @@ proc move_snake
     push ax
     push bx
     push cx
+    push dx
 
     ; Load tail x and y
     mov bx [amount_snake_entries]
@@ -325,28 +297,12 @@ proc move_snake
     mov [tail_x] al ; Store x
     mov [tail_y] ah ; Store y
 
-    ; Shift all snake entries
+    ; Shift all snake entries one place back (the overlapping copy is fine)
+    lea bx [snake_entries]
+    lea dx [snake_entries + 2]
     mov cx [amount_snake_entries]
-shift_snake_body:
     dec cx
-    cmp cx 0
-    je end_shift_snake_body
-
-    ; Store snake entry to copy
-    mov bx cx
-    shl bx 1
-    sub bx 2
-    mov al [snake_entries + bx] ; X
-    mov ah [snake_entries + bx + 1] ; Y
-
-    ; Current entry
-    add bx 2
-    mov [snake_entries + bx + 0] al ; X
-    mov [snake_entries + bx + 1] ah ; Y
-
-    jmp shift_snake_body
-
-end_shift_snake_body:
+    movsw
 
     ; Store new x and y
     mov al [dir_x]
@@ -445,6 +401,7 @@ not_reached_apple:
     ; Update screen
     int 5
 
+    pop dx
     pop cx
     pop bx
     pop ax
@@ -0,0 +1,29 @@
+DATA
+    ticks ew 0
+
+CODE
+start:
+    ; Call `tick` every 200 milliseconds
+    lea ax tick
+    mov bx 200
+    int 11
+wait:
+    ; Sleep until the timer fires
+    int 13
+    cmp [word ticks] 5
+    jb wait
+    ; Remove the timer handler
+    mov bx 0
+    int 11
+    end
+
+proc tick
+    push ax
+    inc [word ticks]
+    mov ax [ticks]
+    int 0
+    mov al 10
+    int 1
+    pop ax
+    iret
+endp tick
@@ -33,15 +33,38 @@ static void Fy_loadInstructionOpcodes(void) {
 
 static void Fy_PrintHelp(void) {
     puts("Welcome to the Fytecode engine!");
-    puts("usage: fy [--add-shebang | -s] [--help | -h] | [--compile | -c] source output | [--run | -r] file");
+    puts("usage: fy [--add-shebang | -s] [--seed number] [--flush policy] [--output-thread] [--headless]");
+    puts("          [--dump-frames prefix] [--frame-format format] [--capture file] [--help | -h]");
+    puts("          | [--compile | -c] source output | [--run | -r] file");
     puts("  --compile or -c source output: assembles file into bytecode");
     puts("  --run or -r file:              runs bytecode on virtual machine");
     puts("  --add-shebang or -s:           add shebang");
+    puts("  --seed number:                 seeds the random generator (default is the time)");
+    puts("  --flush newline|size|halt:     when console output is written (default is newline)");
+    puts("  --output-thread:               writes console output from a separate thread");
+    puts("  --headless:                    draws graphics in memory without opening a window");
+    puts("  --dump-frames prefix:          writes every shown frame to prefix<number>.<format>");
+    puts("  --frame-format ppm|raw:        format of dumped frames, raw is plain RGB24 (default is ppm)");
+    puts("  --capture file:                streams shown frames to file, as Y4M if it ends with .y4m");
+    puts("                                 and as raw RGB24 with times in file.times otherwise");
     puts("  --help or -h:                  shows this help message");
 }
 
 int main(int argc, char **argv) {
     bool add_shebang = false;
+    bool has_flush_policy = false;
+    bool has_frame_format = false;
+    Fy_VMOptions vm_options = {
+        .has_seed = false,
+        .flush_policy = Fy_OutputFlushPolicy_Newline,
+        .output_thread = false,
+        .screen = {
+            .headless = false,
+            .dump_prefix = NULL,
+            .dump_format = Fy_FrameFormat_Ppm,
+            .capture_path = NULL
+        }
+    };
     int i = 1;
 
     // TODO: Allow not setting signal handlers as a command line parameter
@@ -61,6 +84,90 @@ int main(int argc, char **argv) {
             }
             add_shebang = true;
             ++i;
+        } else if (strcmp(argv[i], "--seed") == 0) {
+            char *end;
+            if (vm_options.has_seed) {
+                fprintf(stderr, "Already defined seed\n");
+                return 1;
+            }
+            if (i + 1 >= argc) {
+                fprintf(stderr, "Expected a number after '%s' switch\n", argv[i]);
+                return 1;
+            }
+            errno = 0;
+            vm_options.seed = strtoull(argv[i + 1], &end, 0);
+            if (errno != 0 || *end != '\0' || end == argv[i + 1]) {
+                fprintf(stderr, "Invalid seed '%s'\n", argv[i + 1]);
+                return 1;
+            }
+            vm_options.has_seed = true;
+            i += 2;
+        } else if (strcmp(argv[i], "--flush") == 0) {
+            if (has_flush_policy) {
+                fprintf(stderr, "Already defined flush policy\n");
+                return 1;
+            }
+            if (i + 1 >= argc) {
+                fprintf(stderr, "Expected a policy after '%s' switch\n", argv[i]);
+                return 1;
+            }
+            if (!Fy_OutputFlushPolicy_fromString(argv[i + 1], &vm_options.flush_policy)) {
+                fprintf(stderr, "Invalid flush policy '%s'\n", argv[i + 1]);
+                return 1;
+            }
+            has_flush_policy = true;
+            i += 2;
+        } else if (strcmp(argv[i], "--output-thread") == 0) {
+            if (vm_options.output_thread) {
+                fprintf(stderr, "Already defined output thread\n");
+                return 1;
+            }
+            vm_options.output_thread = true;
+            ++i;
+        } else if (strcmp(argv[i], "--headless") == 0) {
+            if (vm_options.screen.headless) {
+                fprintf(stderr, "Already defined headless\n");
+                return 1;
+            }
+            vm_options.screen.headless = true;
+            ++i;
+        } else if (strcmp(argv[i], "--dump-frames") == 0) {
+            if (vm_options.screen.dump_prefix) {
+                fprintf(stderr, "Already defined frame dump prefix\n");
+                return 1;
+            }
+            if (i + 1 >= argc) {
+                fprintf(stderr, "Expected a prefix after '%s' switch\n", argv[i]);
+                return 1;
+            }
+            vm_options.screen.dump_prefix = argv[i + 1];
+            i += 2;
+        } else if (strcmp(argv[i], "--frame-format") == 0) {
+            if (has_frame_format) {
+                fprintf(stderr, "Already defined frame format\n");
+                return 1;
+            }
+            if (i + 1 >= argc) {
+                fprintf(stderr, "Expected a format after '%s' switch\n", argv[i]);
+                return 1;
+            }
+            if (!Fy_FrameFormat_fromString(argv[i + 1], &vm_options.screen.dump_format)) {
+                fprintf(stderr, "Invalid frame format '%s'\n", argv[i + 1]);
+                return 1;
+            }
+            has_frame_format = true;
+            i += 2;
+        } else if (strcmp(argv[i], "--capture") == 0) {
+            if (vm_options.screen.capture_path) {
+                fprintf(stderr, "Already defined capture file\n");
+                return 1;
+            }
+            if (i + 1 >= argc) {
+                fprintf(stderr, "Expected a file after '%s' switch\n", argv[i]);
+                return 1;
+            }
+            vm_options.screen.capture_path = argv[i + 1];
+            i += 2;
         } else if (strcmp(argv[i], "--compile") == 0 || strcmp(argv[i], "-c") == 0) {
             char *stream;
             Fy_Lexer lexer;
@@ -105,7 +212,7 @@ int main(int argc, char **argv) {
                 return 1;
             }
 
-            Fy_VM_Init(&bc, &vm);
+            Fy_VM_Init(&bc, &vm_options, &vm);
             exit_code = Fy_VM_runAll(&vm);
             Fy_VM_Destruct(&vm);
 
@@ -3,6 +3,9 @@
 
 /* Fytecode forward file */
 
+/* Must be defined before any system header is included */
+#define _POSIX_C_SOURCE 200112L
+
 #define FY_UNREACHABLE() assert(0)
 
 #include "../assembler/token.h"
@@ -15,13 +18,23 @@
 
 #include "../vm/vm.h"
 #include "../vm/timecontrol.h"
+#include "../vm/random.h"
+#include "../vm/output.h"
+#include "../vm/algorithms.h"
+#include "../vm/hashtable.h"
+#include "../vm/heap.h"
+#include "../vm/bignum.h"
+#include "../vm/vector.h"
+#include "../vm/coprocessor.h"
+#include "../vm/palette.h"
+#include "../vm/framedump.h"
+#include "../vm/capture.h"
+#include "../vm/screen.h"
 #include "../vm/registers.h"
 #include "../vm/interrupts.h"
 
 #include "exitsignal.h"
 
-#define _POSIX_C_SOURCE 199309L
-#define __USE_POSIX199309
 #include <unistd.h>
 
 #if !(_POSIX_TIMERS > 0)
@@ -38,6 +51,7 @@
 #include <stdarg.h>
 #include <time.h>
 #include <signal.h>
+#include <errno.h>
 
 #include <SDL2/SDL.h>
 
@@ -0,0 +1,85 @@
+#include "fy.h"
+
+static uint32_t Fy_crc32Table[256];
+static pthread_once_t Fy_crc32TableOnce = PTHREAD_ONCE_INIT;
+
+static void Fy_Algorithm_fillCrc32Table(void) {
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t value = i;
+        for (int bit = 0; bit < 8; ++bit)
+            value = (value & 1) ? (value >> 1) ^ 0xedb88320 : value >> 1;
+        Fy_crc32Table[i] = value;
+    }
+}
+
+/* Counting sort, signed bytes just start counting from -128 */
+void Fy_Algorithm_sortBytes(uint8_t *data, size_t count, bool is_signed) {
+    size_t counts[256] = { 0 };
+    size_t idx = 0;
+    unsigned int first = is_signed ? 0x80 : 0;
+
+    for (size_t i = 0; i < count; ++i)
+        ++counts[data[i]];
+
+    for (unsigned int i = 0; i < 256; ++i) {
+        uint8_t value = (uint8_t)(first + i);
+        memset(&data[idx], value, counts[value]);
+        idx += counts[value];
+    }
+}
+
+/* LSD radix sort with two byte-sized passes, flipping the sign bit orders signed words as unsigned ones */
+void Fy_Algorithm_sortWords(uint16_t *data, size_t count, bool is_signed) {
+    uint16_t flip = is_signed ? 0x8000 : 0;
+    uint16_t *temp;
+    uint16_t *from = data, *to;
+
+    if (count < 2)
+        return;
+
+    temp = malloc(count * sizeof(uint16_t));
+    to = temp;
+
+    for (int shift = 0; shift < 16; shift += 8) {
+        size_t offsets[256] = { 0 };
+        size_t sum = 0;
+        uint16_t *swap;
+
+        for (size_t i = 0; i < count; ++i)
+            ++offsets[((from[i] ^ flip) >> shift) & 0xff];
+        // Turn the counts into starting offsets
+        for (unsigned int i = 0; i < 256; ++i) {
+            size_t amount = offsets[i];
+            offsets[i] = sum;
+            sum += amount;
+        }
+        for (size_t i = 0; i < count; ++i)
+            to[offsets[((from[i] ^ flip) >> shift) & 0xff]++] = from[i];
+
+        swap = from;
+        from = to;
+        to = swap;
+    }
+
+    // After an even amount of passes the result is back in `data`
+    free(temp);
+}
+
+/* Standard (zlib) CRC-32, pass FY_CRC32_INIT or a previous result as `crc` */
+uint32_t Fy_Algorithm_crc32(uint32_t crc, const uint8_t *data, size_t length) {
+    pthread_once(&Fy_crc32TableOnce, Fy_Algorithm_fillCrc32Table);
+
+    crc = ~crc;
+    for (size_t i = 0; i < length; ++i)
+        crc = Fy_crc32Table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+    return ~crc;
+}
+
+/* 32-bit FNV-1a, pass FY_FNV1A32_INIT or a previous result as `hash` */
+uint32_t Fy_Algorithm_fnv1a32(uint32_t hash, const uint8_t *data, size_t length) {
+    for (size_t i = 0; i < length; ++i) {
+        hash ^= data[i];
+        hash *= 0x01000193;
+    }
+    return hash;
+}
@@ -0,0 +1,25 @@
+#ifndef FY_ALGORITHMS_H
+#define FY_ALGORITHMS_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Array flags given to the sort and search interrupts */
+#define FY_ALGORITHM_WORDS (1 << 0)
+#define FY_ALGORITHM_SIGNED (1 << 1)
+
+/* Checksum types */
+#define FY_ALGORITHM_CRC32 0
+#define FY_ALGORITHM_FNV1A32 1
+
+/* Initial values to start a checksum with */
+#define FY_CRC32_INIT 0
+#define FY_FNV1A32_INIT 0x811c9dc5
+
+void Fy_Algorithm_sortBytes(uint8_t *data, size_t count, bool is_signed);
+void Fy_Algorithm_sortWords(uint16_t *data, size_t count, bool is_signed);
+uint32_t Fy_Algorithm_crc32(uint32_t crc, const uint8_t *data, size_t length);
+uint32_t Fy_Algorithm_fnv1a32(uint32_t hash, const uint8_t *data, size_t length);
+
+#endif /* FY_ALGORITHMS_H */
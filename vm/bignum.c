@@ -0,0 +1,211 @@
+#include "fy.h"
+
+/* Returns the amount of limbs without the leading zero limbs */
+static size_t Fy_Bignum_usedLimbs(const uint32_t *number, size_t limbs) {
+    while (limbs > 0 && number[limbs - 1] == 0)
+        --limbs;
+    return limbs;
+}
+
+/* Returns the carry out */
+uint32_t Fy_Bignum_add(uint32_t *dest, const uint32_t *lhs, const uint32_t *rhs, size_t limbs) {
+    uint64_t carry = 0;
+    for (size_t i = 0; i < limbs; ++i) {
+        uint64_t sum = (uint64_t)lhs[i] + rhs[i] + carry;
+        dest[i] = (uint32_t)sum;
+        carry = sum >> 32;
+    }
+    return (uint32_t)carry;
+}
+
+/* Returns the borrow out */
+uint32_t Fy_Bignum_sub(uint32_t *dest, const uint32_t *lhs, const uint32_t *rhs, size_t limbs) {
+    uint64_t borrow = 0;
+    for (size_t i = 0; i < limbs; ++i) {
+        uint64_t difference = (uint64_t)lhs[i] - rhs[i] - borrow;
+        dest[i] = (uint32_t)difference;
+        borrow = difference >> 63;
+    }
+    return (uint32_t)borrow;
+}
+
+/* Schoolbook multiplication, `dest` has `limbs * 2` limbs and may not overlap the operands */
+void Fy_Bignum_mul(uint32_t *dest, const uint32_t *lhs, const uint32_t *rhs, size_t limbs) {
+    size_t lhs_limbs = Fy_Bignum_usedLimbs(lhs, limbs);
+    size_t rhs_limbs = Fy_Bignum_usedLimbs(rhs, limbs);
+
+    memset(dest, 0, limbs * 2 * sizeof(uint32_t));
+    for (size_t i = 0; i < lhs_limbs; ++i) {
+        uint64_t carry = 0;
+        if (lhs[i] == 0)
+            continue;
+        for (size_t j = 0; j < rhs_limbs; ++j) {
+            // At most 0xffffffff * 0xffffffff + 0xffffffff + 0xffffffff, which fits
+            uint64_t product = (uint64_t)lhs[i] * rhs[j] + dest[i + j] + carry;
+            dest[i + j] = (uint32_t)product;
+            carry = product >> 32;
+        }
+        dest[i + rhs_limbs] = (uint32_t)carry;
+    }
+}
+
+/* Divides `number` in place and returns the remainder */
+uint32_t Fy_Bignum_divSmall(uint32_t *number, size_t limbs, uint32_t divisor) {
+    uint64_t remainder = 0;
+    for (size_t i = limbs; i > 0; --i) {
+        uint64_t current = (remainder << 32) | number[i - 1];
+        number[i - 1] = (uint32_t)(current / divisor);
+        remainder = current % divisor;
+    }
+    return (uint32_t)remainder;
+}
+
+/* Amount of leading zero bits in a nonzero limb */
+static int Fy_Bignum_leadingZeros(uint32_t limb) {
+    int count = 0;
+    while (!(limb & 0x80000000)) {
+        limb <<= 1;
+        ++count;
+    }
+    return count;
+}
+
+/*
+ * Knuth's algorithm D: divides the `lhs_limbs` limbs of `lhs` by the `rhs_limbs` limbs of `rhs`, a limb at a time.
+ * `rhs` has at least 2 limbs and no leading zero limbs, and `lhs` isn't shorter than it.
+ */
+static void Fy_Bignum_divLong(uint32_t *quotient, uint32_t *remainder, const uint32_t *lhs, size_t lhs_limbs,
+                              const uint32_t *rhs, size_t rhs_limbs) {
+    // Shifting both operands so the top bit of the divisor is set keeps each quotient limb guess at most 2 off
+    int shift = Fy_Bignum_leadingZeros(rhs[rhs_limbs - 1]);
+    uint32_t *divisor = malloc(rhs_limbs * sizeof(uint32_t));
+    uint32_t *dividend = malloc((lhs_limbs + 1) * sizeof(uint32_t));
+    uint32_t divisor_top;
+
+    // Shifting 64-bit values right by 32 - shift is fine when shift is 0
+    for (size_t i = rhs_limbs - 1; i > 0; --i)
+        divisor[i] = (rhs[i] << shift) | (uint32_t)((uint64_t)rhs[i - 1] >> (32 - shift));
+    divisor[0] = rhs[0] << shift;
+    dividend[lhs_limbs] = (uint32_t)((uint64_t)lhs[lhs_limbs - 1] >> (32 - shift));
+    for (size_t i = lhs_limbs - 1; i > 0; --i)
+        dividend[i] = (lhs[i] << shift) | (uint32_t)((uint64_t)lhs[i - 1] >> (32 - shift));
+    dividend[0] = lhs[0] << shift;
+    divisor_top = divisor[rhs_limbs - 1];
+
+    for (size_t j = lhs_limbs - rhs_limbs + 1; j > 0; --j) {
+        uint32_t *window = &dividend[j - 1];
+        uint64_t top = ((uint64_t)window[rhs_limbs] << 32) | window[rhs_limbs - 1];
+        uint64_t guess = top / divisor_top;
+        uint64_t guess_remainder = top % divisor_top;
+        uint64_t carry = 0, borrow = 0, difference;
+
+        // Correct the guess using the second limb of the divisor
+        while (guess > 0xffffffff ||
+               guess * divisor[rhs_limbs - 2] > ((guess_remainder << 32) | window[rhs_limbs - 2])) {
+            --guess;
+            guess_remainder += divisor_top;
+            if (guess_remainder > 0xffffffff)
+                break;
+        }
+
+        // window -= guess * divisor
+        for (size_t i = 0; i < rhs_limbs; ++i) {
+            uint64_t product = guess * divisor[i] + carry;
+            carry = product >> 32;
+            difference = (uint64_t)window[i] - (uint32_t)product - borrow;
+            window[i] = (uint32_t)difference;
+            borrow = difference >> 63;
+        }
+        difference = (uint64_t)window[rhs_limbs] - carry - borrow;
+        window[rhs_limbs] = (uint32_t)difference;
+
+        // Rarely the guess is still one too big, add the divisor back
+        if (difference >> 63) {
+            --guess;
+            carry = 0;
+            for (size_t i = 0; i < rhs_limbs; ++i) {
+                uint64_t sum = (uint64_t)window[i] + divisor[i] + carry;
+                window[i] = (uint32_t)sum;
+                carry = sum >> 32;
+            }
+            window[rhs_limbs] += (uint32_t)carry;
+        }
+        quotient[j - 1] = (uint32_t)guess;
+    }
+
+    for (size_t i = 0; i < rhs_limbs; ++i)
+        remainder[i] = (dividend[i] >> shift) | (uint32_t)((uint64_t)dividend[i + 1] << (32 - shift));
+
+    free(divisor);
+    free(dividend);
+}
+
+/* Long division, returns false if `rhs` is zero. The outputs may not overlap the inputs */
+bool Fy_Bignum_div(uint32_t *quotient, uint32_t *remainder, const uint32_t *lhs, const uint32_t *rhs, size_t limbs) {
+    size_t rhs_limbs = Fy_Bignum_usedLimbs(rhs, limbs);
+    size_t lhs_limbs = Fy_Bignum_usedLimbs(lhs, limbs);
+
+    if (rhs_limbs == 0)
+        return false;
+
+    memset(quotient, 0, limbs * sizeof(uint32_t));
+    memset(remainder, 0, limbs * sizeof(uint32_t));
+
+    if (lhs_limbs < rhs_limbs) {
+        memcpy(remainder, lhs, limbs * sizeof(uint32_t));
+        return true;
+    }
+
+    // Dividing by a single limb is a lot cheaper
+    if (rhs_limbs == 1) {
+        memcpy(quotient, lhs, limbs * sizeof(uint32_t));
+        remainder[0] = Fy_Bignum_divSmall(quotient, lhs_limbs, rhs[0]);
+        return true;
+    }
+
+    Fy_Bignum_divLong(quotient, remainder, lhs, lhs_limbs, rhs, rhs_limbs);
+    return true;
+}
+
+/* Returns -1, 0 or 1 */
+int Fy_Bignum_compare(const uint32_t *lhs, const uint32_t *rhs, size_t limbs) {
+    for (size_t i = limbs; i > 0; --i) {
+        if (lhs[i - 1] != rhs[i - 1])
+            return lhs[i - 1] < rhs[i - 1] ? -1 : 1;
+    }
+    return 0;
+}
+
+/*
+ * Writes the number in decimal to `out`, returns the length.
+ * `out` needs room for `limbs * 10 + 1` characters, or 11 if `limbs` is 0 since that is written as "0".
+ */
+size_t Fy_Bignum_toDecimal(const uint32_t *number, size_t limbs, char *out) {
+    uint32_t *temp = malloc((limbs ? limbs : 1) * sizeof(uint32_t));
+    size_t used = Fy_Bignum_usedLimbs(number, limbs);
+    size_t length = 0;
+
+    memcpy(temp, number, limbs * sizeof(uint32_t));
+
+    // Peel off nine digits per division, generating them in reverse
+    do {
+        uint32_t chunk = Fy_Bignum_divSmall(temp, used, 1000000000);
+        used = Fy_Bignum_usedLimbs(temp, used);
+        for (int i = 0; i < 9; ++i) {
+            out[length++] = '0' + chunk % 10;
+            chunk /= 10;
+            // Don't add leading zeros to the most significant chunk
+            if (used == 0 && chunk == 0)
+                break;
+        }
+    } while (used > 0);
+    free(temp);
+
+    for (size_t i = 0; i < length / 2; ++i) {
+        char c = out[i];
+        out[i] = out[length - 1 - i];
+        out[length - 1 - i] = c;
+    }
+    out[length] = '\0';
+    return length;
+}
@@ -0,0 +1,24 @@
+#ifndef FY_BIGNUM_H
+#define FY_BIGNUM_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+ * Unsigned integers made of `limbs` 32-bit limbs, least significant limb first.
+ * Guest numbers are made of 16-bit words, which are packed two to a limb.
+ */
+
+/* Amount of limbs needed to hold `words` 16-bit words */
+#define FY_BIGNUM_LIMBS(words) (((size_t)(words) + 1) / 2)
+
+uint32_t Fy_Bignum_add(uint32_t *dest, const uint32_t *lhs, const uint32_t *rhs, size_t limbs);
+uint32_t Fy_Bignum_sub(uint32_t *dest, const uint32_t *lhs, const uint32_t *rhs, size_t limbs);
+void Fy_Bignum_mul(uint32_t *dest, const uint32_t *lhs, const uint32_t *rhs, size_t limbs);
+bool Fy_Bignum_div(uint32_t *quotient, uint32_t *remainder, const uint32_t *lhs, const uint32_t *rhs, size_t limbs);
+int Fy_Bignum_compare(const uint32_t *lhs, const uint32_t *rhs, size_t limbs);
+uint32_t Fy_Bignum_divSmall(uint32_t *number, size_t limbs, uint32_t divisor);
+size_t Fy_Bignum_toDecimal(const uint32_t *number, size_t limbs, char *out);
+
+#endif /* FY_BIGNUM_H */
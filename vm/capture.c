@@ -0,0 +1,193 @@
+#include "fy.h"
+
+/* Y, Cb and Cr of every palette color, in the limited range of BT.601 */
+static uint8_t Fy_Capture_yuvPalette[3][FY_SCREEN_PALETTE_SIZE];
+
+static void Fy_Capture_loadYuvPalette(void) {
+    for (size_t i = 0; i < FY_SCREEN_PALETTE_SIZE; ++i) {
+        double r = Fy_screenPalette[i].r, g = Fy_screenPalette[i].g, b = Fy_screenPalette[i].b;
+        Fy_Capture_yuvPalette[0][i] = (uint8_t)(16.5 + (65.481 * r + 128.553 * g + 24.966 * b) / 255);
+        Fy_Capture_yuvPalette[1][i] = (uint8_t)(128.5 + (-37.797 * r - 74.203 * g + 112 * b) / 255);
+        Fy_Capture_yuvPalette[2][i] = (uint8_t)(128.5 + (112 * r - 93.786 * g - 18.214 * b) / 255);
+    }
+}
+
+/* Writes a frame to the files, returns false if they couldn't be written */
+static bool Fy_Capture_writeFrame(Fy_Capture *capture, Fy_CaptureFrame *frame, uint8_t *converted) {
+    size_t count = (size_t)capture->width * capture->height;
+
+    if (capture->format == Fy_CaptureFormat_Y4m) {
+        // Three planes, every one of them a lookup of the same indices
+        for (int plane = 0; plane < 3; ++plane) {
+            for (size_t i = 0; i < count; ++i)
+                converted[plane * count + i] = Fy_Capture_yuvPalette[plane][frame->pixels[i]];
+        }
+        if (fprintf(capture->file, "FRAME Xtime=%" PRIu64 "\n", frame->time) < 0)
+            return false;
+    } else {
+        Fy_FrameDump_toRgb(frame->pixels, count, converted);
+        if (fprintf(capture->times_file, "%" PRIu64 "\n", frame->time) < 0)
+            return false;
+    }
+    return fwrite(converted, 1, count * 3, capture->file) == count * 3;
+}
+
+/* Converts and writes the frames in the ring, without holding the lock while writing */
+static void *Fy_Capture_writerThread(void *arg) {
+    Fy_Capture *capture = arg;
+    uint8_t *converted = NULL;
+
+    pthread_mutex_lock(&capture->lock);
+    for (;;) {
+        Fy_CaptureFrame *frame;
+
+        while (capture->ring_length == 0 && !capture->stop)
+            pthread_cond_wait(&capture->has_frame, &capture->lock);
+        if (capture->ring_length == 0)
+            break;
+
+        // The producer never touches used frames, so they can be read unlocked
+        frame = &capture->ring[capture->ring_start];
+        pthread_mutex_unlock(&capture->lock);
+
+        if (!converted)
+            converted = malloc((size_t)capture->width * capture->height * 3 + 1);
+        if (!capture->failed && !Fy_Capture_writeFrame(capture, frame, converted))
+            capture->failed = true;
+
+        pthread_mutex_lock(&capture->lock);
+        capture->ring_start = (capture->ring_start + 1) % FY_CAPTURE_RING_FRAMES;
+        --capture->ring_length;
+        pthread_cond_signal(&capture->has_space);
+    }
+    pthread_mutex_unlock(&capture->lock);
+
+    free(converted);
+    return NULL;
+}
+
+static bool Fy_Capture_hasSuffix(char *string, char *suffix) {
+    size_t length = strlen(string), suffix_length = strlen(suffix);
+    return length >= suffix_length && strcmp(&string[length - suffix_length], suffix) == 0;
+}
+
+/*
+ * Starts capturing to `path`, as Y4M if it ends with ".y4m" and as raw RGB24 otherwise.
+ * Returns whether the operation was successful.
+ */
+bool Fy_Capture_Init(Fy_Capture *out, char *path) {
+    sigset_t block, old;
+    int err;
+
+    out->format = Fy_Capture_hasSuffix(path, ".y4m") ? Fy_CaptureFormat_Y4m : Fy_CaptureFormat_Raw;
+    out->file = fopen(path, "wb");
+    if (!out->file)
+        return false;
+
+    out->times_file = NULL;
+    if (out->format == Fy_CaptureFormat_Raw) {
+        size_t name_length = strlen(path) + sizeof(".times");
+        char *name = malloc(name_length);
+        snprintf(name, name_length, "%s.times", path);
+        out->times_file = fopen(name, "w");
+        free(name);
+        if (!out->times_file) {
+            fclose(out->file);
+            return false;
+        }
+    } else {
+        Fy_Capture_loadYuvPalette();
+    }
+
+    out->start_time = Fy_Time_getMonotonicMilliseconds();
+    out->width = 0;
+    out->height = 0;
+    for (size_t i = 0; i < FY_CAPTURE_RING_FRAMES; ++i)
+        out->ring[i].pixels = NULL;
+    out->ring_start = 0;
+    out->ring_length = 0;
+    out->stop = false;
+    out->failed = false;
+    pthread_mutex_init(&out->lock, NULL);
+    pthread_cond_init(&out->has_frame, NULL);
+    pthread_cond_init(&out->has_space, NULL);
+
+    // Exit signals should interrupt the virtual machine, not the writer
+    sigemptyset(&block);
+    sigaddset(&block, SIGINT);
+    sigaddset(&block, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &block, &old);
+    err = pthread_create(&out->thread, NULL, Fy_Capture_writerThread, out);
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+
+    if (err != 0) {
+        pthread_cond_destroy(&out->has_space);
+        pthread_cond_destroy(&out->has_frame);
+        pthread_mutex_destroy(&out->lock);
+        if (out->times_file)
+            fclose(out->times_file);
+        fclose(out->file);
+        return false;
+    }
+    return true;
+}
+
+/* Waits for the writer thread to write the frames that are left and closes the files */
+void Fy_Capture_Destruct(Fy_Capture *capture) {
+    bool failed;
+
+    pthread_mutex_lock(&capture->lock);
+    capture->stop = true;
+    pthread_cond_signal(&capture->has_frame);
+    pthread_mutex_unlock(&capture->lock);
+    pthread_join(capture->thread, NULL);
+
+    failed = capture->failed;
+    if (capture->times_file && fclose(capture->times_file) != 0)
+        failed = true;
+    if (fclose(capture->file) != 0)
+        failed = true;
+
+    if (failed)
+        fprintf(stderr, "Couldn't write all of the captured frames\n");
+
+    pthread_cond_destroy(&capture->has_space);
+    pthread_cond_destroy(&capture->has_frame);
+    pthread_mutex_destroy(&capture->lock);
+    for (size_t i = 0; i < FY_CAPTURE_RING_FRAMES; ++i)
+        free(capture->ring[i].pixels);
+}
+
+/* Queues a copy of a frame of palette indices for the writer thread */
+void Fy_Capture_addFrame(Fy_Capture *capture, const uint8_t *pixels, int width, int height) {
+    size_t size = (size_t)width * height;
+    Fy_CaptureFrame *frame;
+
+    // The header is written once, since the screen never changes size
+    if (capture->width == 0 && capture->height == 0) {
+        capture->width = width;
+        capture->height = height;
+        if (capture->format == Fy_CaptureFormat_Y4m) {
+            fprintf(capture->file, "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C444\n", width, height,
+                    FY_CAPTURE_Y4M_FRAME_RATE);
+        }
+    }
+
+    pthread_mutex_lock(&capture->lock);
+    // Only blocks if the writer is behind by a whole ring
+    while (capture->ring_length == FY_CAPTURE_RING_FRAMES)
+        pthread_cond_wait(&capture->has_space, &capture->lock);
+    frame = &capture->ring[(capture->ring_start + capture->ring_length) % FY_CAPTURE_RING_FRAMES];
+    pthread_mutex_unlock(&capture->lock);
+
+    // The writer doesn't touch free frames, so they can be filled unlocked
+    if (!frame->pixels)
+        frame->pixels = malloc(size ? size : 1);
+    memcpy(frame->pixels, pixels, size);
+    frame->time = Fy_Time_getMonotonicMilliseconds() - capture->start_time;
+
+    pthread_mutex_lock(&capture->lock);
+    ++capture->ring_length;
+    pthread_cond_signal(&capture->has_frame);
+    pthread_mutex_unlock(&capture->lock);
+}
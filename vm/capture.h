@@ -0,0 +1,57 @@
+#ifndef FY_CAPTURE_H
+#define FY_CAPTURE_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <pthread.h>
+
+/* Frames that can wait for the writer thread before the program has to */
+#define FY_CAPTURE_RING_FRAMES 8
+/* Frame rate written in Y4M headers, the real times are in every frame header */
+#define FY_CAPTURE_Y4M_FRAME_RATE 60
+
+typedef enum Fy_CaptureFormat Fy_CaptureFormat;
+typedef struct Fy_CaptureFrame Fy_CaptureFrame;
+typedef struct Fy_Capture Fy_Capture;
+
+enum Fy_CaptureFormat {
+    /* RGB24 frames one after another, with the times in a separate text file */
+    Fy_CaptureFormat_Raw = 1,
+    /* YUV4MPEG2 with 4:4:4 sampling, the time of each frame is in its header */
+    Fy_CaptureFormat_Y4m
+};
+
+struct Fy_CaptureFrame {
+    /* Palette indices, converted by the writer thread */
+    uint8_t *pixels;
+    /* Milliseconds since the capture started */
+    uint64_t time;
+};
+
+/* Stream of the frames a program shows, written by a separate thread */
+struct Fy_Capture {
+    Fy_CaptureFormat format;
+    FILE *file;
+    /* Times of the raw frames, one per line */
+    FILE *times_file;
+    uint64_t start_time;
+    /* Size of every frame, known from the first one */
+    int width, height;
+
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t has_frame, has_space;
+    Fy_CaptureFrame ring[FY_CAPTURE_RING_FRAMES];
+    size_t ring_start, ring_length;
+    bool stop;
+    /* Set by the writer thread if the file couldn't be written */
+    bool failed;
+};
+
+bool Fy_Capture_Init(Fy_Capture *out, char *path);
+void Fy_Capture_Destruct(Fy_Capture *capture);
+void Fy_Capture_addFrame(Fy_Capture *capture, const uint8_t *pixels, int width, int height);
+
+#endif /* FY_CAPTURE_H */
@@ -0,0 +1,109 @@
+#include "fy.h"
+
+#include <math.h>
+
+/* Host math behind the fixed-point and float32 interrupts */
+
+float Fy_Coprocessor_floatFromBits(uint32_t bits) {
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+uint32_t Fy_Coprocessor_floatToBits(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+/* Truncates into the signed 16-bit range, saturating at its ends, NaN becomes 0 */
+int16_t Fy_Coprocessor_floatToInt16(float value) {
+    if (isnan(value))
+        return 0;
+    if (value <= INT16_MIN)
+        return INT16_MIN;
+    if (value >= INT16_MAX)
+        return INT16_MAX;
+    return (int16_t)value;
+}
+
+/* Rounds to the nearest fixed-point value, saturating to the format's range */
+static int32_t Fy_Coprocessor_toFixed(double value, bool is_16_16) {
+    double min = is_16_16 ? INT32_MIN : INT16_MIN;
+    double max = is_16_16 ? INT32_MAX : INT16_MAX;
+
+    value = ldexp(value, is_16_16 ? 16 : 8);
+    if (isnan(value))
+        return 0;
+    if (value <= min)
+        return (int32_t)min;
+    if (value >= max)
+        return (int32_t)max;
+    return (int32_t)lround(value);
+}
+
+/* Returns false if `function` is invalid */
+bool Fy_Coprocessor_runFixed(uint8_t function, bool is_16_16, int32_t lhs, int32_t rhs, int32_t *out) {
+    int exponent = is_16_16 ? -16 : -8;
+    double lhs_value = ldexp(lhs, exponent);
+    double rhs_value = ldexp(rhs, exponent);
+    double result;
+
+    switch (function) {
+    case Fy_FixedFunction_Sqrt:
+        // The square root of a negative number is NaN, which gives 0
+        result = sqrt(lhs_value);
+        break;
+    case Fy_FixedFunction_Sin:
+        result = sin(lhs_value);
+        break;
+    case Fy_FixedFunction_Cos:
+        result = cos(lhs_value);
+        break;
+    case Fy_FixedFunction_Atan2:
+        result = atan2(lhs_value, rhs_value);
+        break;
+    default:
+        return false;
+    }
+
+    *out = Fy_Coprocessor_toFixed(result, is_16_16);
+    return true;
+}
+
+/* Runs `operator` on the float32 bit patterns, returns false if `operator` is invalid */
+bool Fy_Coprocessor_runFloat(uint8_t operator, uint32_t lhs, uint32_t rhs, uint32_t *out) {
+    float lhs_value = Fy_Coprocessor_floatFromBits(lhs);
+    float rhs_value = Fy_Coprocessor_floatFromBits(rhs);
+
+    switch (operator) {
+    case Fy_FloatOperator_Add:
+        *out = Fy_Coprocessor_floatToBits(lhs_value + rhs_value);
+        break;
+    case Fy_FloatOperator_Sub:
+        *out = Fy_Coprocessor_floatToBits(lhs_value - rhs_value);
+        break;
+    case Fy_FloatOperator_Mul:
+        *out = Fy_Coprocessor_floatToBits(lhs_value * rhs_value);
+        break;
+    case Fy_FloatOperator_Div:
+        *out = Fy_Coprocessor_floatToBits(lhs_value / rhs_value);
+        break;
+    case Fy_FloatOperator_Compare:
+        if (isnan(lhs_value) || isnan(rhs_value))
+            *out = FY_FLOAT_UNORDERED;
+        else
+            *out = (uint32_t)((lhs_value > rhs_value) - (lhs_value < rhs_value));
+        break;
+    case Fy_FloatOperator_FromInt:
+        *out = Fy_Coprocessor_floatToBits((float)(int16_t)lhs);
+        break;
+    case Fy_FloatOperator_ToInt:
+        *out = (uint16_t)Fy_Coprocessor_floatToInt16(lhs_value);
+        break;
+    default:
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,46 @@
+#ifndef FY_COPROCESSOR_H
+#define FY_COPROCESSOR_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+
+/* Flag given above the function id in `si` to the fixed-point interrupt, otherwise the numbers are 8.8 */
+#define FY_FIXED_16_16 (1 << 8)
+/* Flag given above the operator id in `si` to the float interrupt, the operands are then addresses */
+#define FY_FLOAT_MEMORY (1 << 8)
+
+/* Returned by a float comparison when one of the operands is NaN */
+#define FY_FLOAT_UNORDERED 2
+
+typedef enum Fy_FixedFunction Fy_FixedFunction;
+typedef enum Fy_FloatOperator Fy_FloatOperator;
+
+/* Angles are in radians, in the same fixed-point format as the operands */
+enum Fy_FixedFunction {
+    Fy_FixedFunction_Sqrt = 0,
+    Fy_FixedFunction_Sin,
+    Fy_FixedFunction_Cos,
+    /* atan2(lhs, rhs), where lhs is y and rhs is x */
+    Fy_FixedFunction_Atan2
+};
+
+enum Fy_FloatOperator {
+    Fy_FloatOperator_Add = 0,
+    Fy_FloatOperator_Sub,
+    Fy_FloatOperator_Mul,
+    Fy_FloatOperator_Div,
+    /* Returns -1, 0, 1 or FY_FLOAT_UNORDERED */
+    Fy_FloatOperator_Compare,
+    /* Converts the signed 16-bit integer in the low word of lhs */
+    Fy_FloatOperator_FromInt,
+    /* Truncates into a saturated signed 16-bit integer, NaN becomes 0 */
+    Fy_FloatOperator_ToInt
+};
+
+bool Fy_Coprocessor_runFixed(uint8_t function, bool is_16_16, int32_t lhs, int32_t rhs, int32_t *out);
+bool Fy_Coprocessor_runFloat(uint8_t operator, uint32_t lhs, uint32_t rhs, uint32_t *out);
+float Fy_Coprocessor_floatFromBits(uint32_t bits);
+uint32_t Fy_Coprocessor_floatToBits(float value);
+int16_t Fy_Coprocessor_floatToInt16(float value);
+
+#endif /* FY_COPROCESSOR_H */
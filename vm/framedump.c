@@ -0,0 +1,61 @@
+#include "fy.h"
+
+bool Fy_FrameFormat_fromString(char *name, Fy_FrameFormat *out) {
+    if (strcmp(name, "ppm") == 0)
+        *out = Fy_FrameFormat_Ppm;
+    else if (strcmp(name, "raw") == 0)
+        *out = Fy_FrameFormat_Raw;
+    else
+        return false;
+    return true;
+}
+
+static char *Fy_FrameFormat_getExtension(Fy_FrameFormat format) {
+    switch (format) {
+    case Fy_FrameFormat_Ppm:
+        return "ppm";
+    case Fy_FrameFormat_Raw:
+        return "raw";
+    default:
+        FY_UNREACHABLE();
+        return NULL;
+    }
+}
+
+/* Converts `count` palette indices to RGB24 pixels */
+void Fy_FrameDump_toRgb(const uint8_t *pixels, size_t count, uint8_t *out) {
+    for (size_t i = 0; i < count; ++i) {
+        SDL_Color color = Fy_screenPalette[pixels[i]];
+        out[i * 3] = color.r;
+        out[i * 3 + 1] = color.g;
+        out[i * 3 + 2] = color.b;
+    }
+}
+
+/* Writes a frame of palette indices to `prefix` followed by the frame number, returns false if the file can't be written */
+bool Fy_FrameDump_write(const char *prefix, Fy_FrameFormat format, uint32_t number, const uint8_t *pixels, int width,
+                        int height) {
+    size_t count = (size_t)width * height;
+    size_t name_length = strlen(prefix) + 16;
+    char *name = malloc(name_length);
+    uint8_t *rgb;
+    FILE *file;
+    bool success;
+
+    snprintf(name, name_length, "%s%06" PRIu32 ".%s", prefix, number, Fy_FrameFormat_getExtension(format));
+    file = fopen(name, "wb");
+    free(name);
+    if (!file)
+        return false;
+
+    rgb = malloc(count * 3 + 1);
+    Fy_FrameDump_toRgb(pixels, count, rgb);
+    if (format == Fy_FrameFormat_Ppm)
+        fprintf(file, "P6\n%d %d\n255\n", width, height);
+    success = fwrite(rgb, 1, count * 3, file) == count * 3;
+    free(rgb);
+
+    if (fclose(file) != 0)
+        success = false;
+    return success;
+}
@@ -0,0 +1,22 @@
+#ifndef FY_FRAMEDUMP_H
+#define FY_FRAMEDUMP_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef enum Fy_FrameFormat Fy_FrameFormat;
+
+enum Fy_FrameFormat {
+    /* Binary PPM (P6) image */
+    Fy_FrameFormat_Ppm = 1,
+    /* Just the RGB24 pixels, row after row */
+    Fy_FrameFormat_Raw
+};
+
+bool Fy_FrameFormat_fromString(char *name, Fy_FrameFormat *out);
+void Fy_FrameDump_toRgb(const uint8_t *pixels, size_t count, uint8_t *out);
+bool Fy_FrameDump_write(const char *prefix, Fy_FrameFormat format, uint32_t number, const uint8_t *pixels, int width,
+                        int height);
+
+#endif /* FY_FRAMEDUMP_H */
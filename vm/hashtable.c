@@ -0,0 +1,212 @@
+#include "fy.h"
+
+#define FY_HASHTABLE_INITIAL_CAPACITY 16
+
+/*
+ * Slots are picked by the low bits of the hash, so every bit of the word has to reach them.
+ * This is the MurmurHash3 finalizer, which also spreads keys that only differ in their high bits.
+ */
+static uint32_t Fy_HashtableKey_mixWord(uint16_t word) {
+    uint32_t hash = (uint32_t)word * 0x9e3779b1;
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6b;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+static uint32_t Fy_HashtableKey_hash(Fy_HashtableKey *key, Fy_HashtableKeyType key_type) {
+    if (key_type == Fy_HashtableKeyType_String)
+        return Fy_Algorithm_fnv1a32(FY_FNV1A32_INIT, key->string, key->length);
+    return Fy_HashtableKey_mixWord(key->word);
+}
+
+static bool Fy_HashtableEntry_matches(Fy_HashtableEntry *entry, Fy_HashtableKey *key, uint32_t hash,
+                                      Fy_HashtableKeyType key_type) {
+    if (entry->hash != hash)
+        return false;
+    if (key_type == Fy_HashtableKeyType_String)
+        return entry->length == key->length && memcmp(entry->string, key->string, key->length) == 0;
+    return entry->word == key->word;
+}
+
+static size_t Fy_Hashtable_home(Fy_Hashtable *table, uint32_t hash) {
+    return hash & (table->capacity - 1);
+}
+
+/* Returns the index of the entry with `key` or of the free slot where it would go */
+static size_t Fy_Hashtable_find(Fy_Hashtable *table, Fy_HashtableKey *key, uint32_t hash) {
+    size_t idx = Fy_Hashtable_home(table, hash);
+    while (table->entries[idx].used && !Fy_HashtableEntry_matches(&table->entries[idx], key, hash, table->key_type))
+        idx = (idx + 1) & (table->capacity - 1);
+    return idx;
+}
+
+void Fy_Hashtables_Init(Fy_Hashtables *out) {
+    for (size_t i = 0; i < FY_HASHTABLES_MAX; ++i)
+        out->tables[i].in_use = false;
+    out->memory_used = 0;
+}
+
+void Fy_Hashtables_Destruct(Fy_Hashtables *hashtables) {
+    for (uint16_t i = 0; i < FY_HASHTABLES_MAX; ++i) {
+        if (hashtables->tables[i].in_use)
+            Fy_Hashtables_destroy(hashtables, i + 1);
+    }
+}
+
+/* Returns a handle to a new table, or 0 if there are too many tables or not enough memory */
+uint16_t Fy_Hashtables_create(Fy_Hashtables *hashtables, Fy_HashtableKeyType key_type) {
+    size_t size = FY_HASHTABLE_INITIAL_CAPACITY * sizeof(Fy_HashtableEntry);
+
+    if (hashtables->memory_used + size > FY_HASHTABLES_MEMORY_LIMIT)
+        return 0;
+
+    for (uint16_t i = 0; i < FY_HASHTABLES_MAX; ++i) {
+        Fy_Hashtable *table = &hashtables->tables[i];
+        if (table->in_use)
+            continue;
+        table->in_use = true;
+        table->key_type = key_type;
+        table->entries = calloc(FY_HASHTABLE_INITIAL_CAPACITY, sizeof(Fy_HashtableEntry));
+        table->capacity = FY_HASHTABLE_INITIAL_CAPACITY;
+        table->amount = 0;
+        hashtables->memory_used += size;
+        return i + 1;
+    }
+
+    return 0;
+}
+
+/* Returns NULL if the handle doesn't refer to a table */
+Fy_Hashtable *Fy_Hashtables_get(Fy_Hashtables *hashtables, uint16_t handle) {
+    if (handle == 0 || handle > FY_HASHTABLES_MAX || !hashtables->tables[handle - 1].in_use)
+        return NULL;
+    return &hashtables->tables[handle - 1];
+}
+
+void Fy_Hashtables_destroy(Fy_Hashtables *hashtables, uint16_t handle) {
+    Fy_Hashtable *table = Fy_Hashtables_get(hashtables, handle);
+
+    assert(table);
+    for (size_t i = 0; i < table->capacity; ++i) {
+        if (table->entries[i].used && table->entries[i].string) {
+            hashtables->memory_used -= table->entries[i].length;
+            free(table->entries[i].string);
+        }
+    }
+    hashtables->memory_used -= table->capacity * sizeof(Fy_HashtableEntry);
+    free(table->entries);
+    table->in_use = false;
+}
+
+/* Doubles the capacity and reinserts all entries, returns false if over the memory limit */
+static bool Fy_Hashtables_grow(Fy_Hashtables *hashtables, Fy_Hashtable *table) {
+    size_t old_capacity = table->capacity;
+    Fy_HashtableEntry *old_entries = table->entries;
+    size_t added_size = old_capacity * sizeof(Fy_HashtableEntry);
+
+    if (hashtables->memory_used + added_size > FY_HASHTABLES_MEMORY_LIMIT)
+        return false;
+
+    table->capacity = old_capacity * 2;
+    table->entries = calloc(table->capacity, sizeof(Fy_HashtableEntry));
+    for (size_t i = 0; i < old_capacity; ++i) {
+        size_t idx;
+        if (!old_entries[i].used)
+            continue;
+        idx = Fy_Hashtable_home(table, old_entries[i].hash);
+        while (table->entries[idx].used)
+            idx = (idx + 1) & (table->capacity - 1);
+        table->entries[idx] = old_entries[i];
+    }
+    free(old_entries);
+    hashtables->memory_used += added_size;
+
+    return true;
+}
+
+/* Sets the value of `key`, returns false if over the memory limit */
+bool Fy_Hashtables_insert(Fy_Hashtables *hashtables, Fy_Hashtable *table, Fy_HashtableKey *key, uint16_t value) {
+    uint32_t hash = Fy_HashtableKey_hash(key, table->key_type);
+    size_t idx = Fy_Hashtable_find(table, key, hash);
+    Fy_HashtableEntry *entry;
+
+    if (table->entries[idx].used) {
+        table->entries[idx].value = value;
+        return true;
+    }
+
+    // Keep the load factor under 3/4 so probe sequences stay short
+    if ((table->amount + 1) * 4 > table->capacity * 3) {
+        if (!Fy_Hashtables_grow(hashtables, table))
+            return false;
+        idx = Fy_Hashtable_find(table, key, hash);
+    }
+
+    entry = &table->entries[idx];
+    entry->string = NULL;
+    entry->length = 0;
+    if (table->key_type == Fy_HashtableKeyType_String) {
+        if (hashtables->memory_used + key->length > FY_HASHTABLES_MEMORY_LIMIT)
+            return false;
+        entry->string = malloc(key->length ? key->length : 1);
+        memcpy(entry->string, key->string, key->length);
+        entry->length = key->length;
+        hashtables->memory_used += key->length;
+    }
+    entry->used = true;
+    entry->hash = hash;
+    entry->word = key->word;
+    entry->value = value;
+    ++table->amount;
+
+    return true;
+}
+
+/* Puts the value of `key` in `out`, returns whether it was found */
+bool Fy_Hashtable_lookup(Fy_Hashtable *table, Fy_HashtableKey *key, uint16_t *out) {
+    uint32_t hash = Fy_HashtableKey_hash(key, table->key_type);
+    size_t idx = Fy_Hashtable_find(table, key, hash);
+
+    if (!table->entries[idx].used)
+        return false;
+    *out = table->entries[idx].value;
+    return true;
+}
+
+/* Removes `key` with backward shift deletion so no tombstones are needed, returns whether it was found */
+bool Fy_Hashtables_remove(Fy_Hashtables *hashtables, Fy_Hashtable *table, Fy_HashtableKey *key) {
+    uint32_t hash = Fy_HashtableKey_hash(key, table->key_type);
+    size_t mask = table->capacity - 1;
+    size_t hole = Fy_Hashtable_find(table, key, hash);
+    size_t idx;
+
+    if (!table->entries[hole].used)
+        return false;
+
+    if (table->entries[hole].string) {
+        hashtables->memory_used -= table->entries[hole].length;
+        free(table->entries[hole].string);
+    }
+
+    // Move back every following entry that may sit in the hole
+    idx = hole;
+    for (;;) {
+        size_t home;
+        idx = (idx + 1) & mask;
+        if (!table->entries[idx].used)
+            break;
+        home = Fy_Hashtable_home(table, table->entries[idx].hash);
+        // The entry can move if its home isn't in the cyclic range (hole, idx]
+        if (((idx - home) & mask) >= ((idx - hole) & mask)) {
+            table->entries[hole] = table->entries[idx];
+            hole = idx;
+        }
+    }
+    table->entries[hole].used = false;
+    --table->amount;
+
+    return true;
+}
@@ -0,0 +1,64 @@
+#ifndef FY_HASHTABLE_H
+#define FY_HASHTABLE_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Amount of tables a program can have at once */
+#define FY_HASHTABLES_MAX 16
+/* Host memory all tables of a virtual machine can use together */
+#define FY_HASHTABLES_MEMORY_LIMIT (1024 * 1024)
+
+typedef enum Fy_HashtableKeyType Fy_HashtableKeyType;
+typedef struct Fy_HashtableKey Fy_HashtableKey;
+typedef struct Fy_HashtableEntry Fy_HashtableEntry;
+typedef struct Fy_Hashtable Fy_Hashtable;
+typedef struct Fy_Hashtables Fy_Hashtables;
+
+enum Fy_HashtableKeyType {
+    Fy_HashtableKeyType_Word = 1,
+    Fy_HashtableKeyType_String
+};
+
+/* A key to look up, `string` is only used by string tables */
+struct Fy_HashtableKey {
+    uint16_t word;
+    const uint8_t *string;
+    uint16_t length;
+};
+
+struct Fy_HashtableEntry {
+    bool used;
+    uint32_t hash;
+    uint16_t word;
+    /* Owned copy of the key in string tables */
+    uint8_t *string;
+    uint16_t length;
+    uint16_t value;
+};
+
+/* Open addressing table with linear probing, the capacity is always a power of 2 */
+struct Fy_Hashtable {
+    bool in_use;
+    Fy_HashtableKeyType key_type;
+    Fy_HashtableEntry *entries;
+    size_t capacity, amount;
+};
+
+/* All tables of a virtual machine, handles are indices plus one so 0 is never valid */
+struct Fy_Hashtables {
+    Fy_Hashtable tables[FY_HASHTABLES_MAX];
+    size_t memory_used;
+};
+
+void Fy_Hashtables_Init(Fy_Hashtables *out);
+void Fy_Hashtables_Destruct(Fy_Hashtables *hashtables);
+uint16_t Fy_Hashtables_create(Fy_Hashtables *hashtables, Fy_HashtableKeyType key_type);
+Fy_Hashtable *Fy_Hashtables_get(Fy_Hashtables *hashtables, uint16_t handle);
+void Fy_Hashtables_destroy(Fy_Hashtables *hashtables, uint16_t handle);
+bool Fy_Hashtables_insert(Fy_Hashtables *hashtables, Fy_Hashtable *table, Fy_HashtableKey *key, uint16_t value);
+bool Fy_Hashtable_lookup(Fy_Hashtable *table, Fy_HashtableKey *key, uint16_t *out);
+bool Fy_Hashtables_remove(Fy_Hashtables *hashtables, Fy_Hashtable *table, Fy_HashtableKey *key);
+
+#endif /* FY_HASHTABLE_H */
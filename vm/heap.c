@@ -0,0 +1,182 @@
+#include "fy.h"
+
+static void Fy_HeapFreeList_push(Fy_HeapFreeList *list, uint16_t address, uint16_t size) {
+    if (list->allocated == 0)
+        list->blocks = malloc((list->allocated = 8) * sizeof(Fy_HeapBlock));
+    else if (list->amount == list->allocated)
+        list->blocks = realloc(list->blocks, (list->allocated *= 2) * sizeof(Fy_HeapBlock));
+    list->blocks[list->amount].address = address;
+    list->blocks[list->amount].size = size;
+    ++list->amount;
+}
+
+/* Returns the size class of `size`, or -1 if it is a large block */
+static int Fy_Heap_getSizeClass(uint32_t size) {
+    uint32_t class_size = FY_HEAP_GRANULE;
+    for (int i = 0; i < FY_HEAP_SMALL_CLASSES; ++i) {
+        if (size <= class_size)
+            return i;
+        class_size *= 2;
+    }
+    return -1;
+}
+
+/* Returns the free list blocks of `size` bytes are kept in */
+static Fy_HeapFreeList *Fy_Heap_getFreeList(Fy_Heap *heap, uint16_t size) {
+    int size_class = Fy_Heap_getSizeClass(size);
+    return size_class >= 0 ? &heap->small[size_class] : &heap->large;
+}
+
+static void Fy_Heap_addFreeBlock(Fy_Heap *heap, uint16_t address, uint16_t size) {
+    Fy_HeapFreeList *list = Fy_Heap_getFreeList(heap, size);
+    heap->free_sizes[address / FY_HEAP_GRANULE] = size;
+    heap->free_indices[address / FY_HEAP_GRANULE] = (uint16_t)list->amount;
+    heap->free_starts[((uint32_t)address + size) / FY_HEAP_GRANULE - 1] = address;
+    Fy_HeapFreeList_push(list, address, size);
+}
+
+static void Fy_Heap_removeFreeBlock(Fy_Heap *heap, uint16_t address) {
+    Fy_HeapFreeList *list = Fy_Heap_getFreeList(heap, heap->free_sizes[address / FY_HEAP_GRANULE]);
+    uint16_t index = heap->free_indices[address / FY_HEAP_GRANULE];
+    // Fill the hole with the last block of the list
+    list->blocks[index] = list->blocks[--list->amount];
+    heap->free_indices[list->blocks[index].address / FY_HEAP_GRANULE] = index;
+    heap->free_sizes[address / FY_HEAP_GRANULE] = 0;
+}
+
+/* Returns the address of the free block that ends at `end`, or 0 if there is none */
+static uint16_t Fy_Heap_getFreeBlockBefore(Fy_Heap *heap, uint32_t end) {
+    uint16_t address;
+    if (end <= heap->start)
+        return 0;
+    // The start kept at the last granule may be left over from a block that is gone
+    address = heap->free_starts[end / FY_HEAP_GRANULE - 1];
+    if (address < heap->start || address >= end || heap->free_sizes[address / FY_HEAP_GRANULE] != end - address)
+        return 0;
+    return address;
+}
+
+void Fy_Heap_Init(Fy_Heap *out, uint32_t start, uint32_t end) {
+    // Round the start up to a whole granule
+    start = (start + FY_HEAP_GRANULE - 1) / FY_HEAP_GRANULE * FY_HEAP_GRANULE;
+    if (start > end)
+        start = end;
+    out->start = start;
+    out->end = end;
+    out->top = start;
+    memset(out->block_sizes, 0, sizeof(out->block_sizes));
+    memset(out->free_sizes, 0, sizeof(out->free_sizes));
+    memset(out->free_indices, 0, sizeof(out->free_indices));
+    memset(out->free_starts, 0, sizeof(out->free_starts));
+    for (int i = 0; i < FY_HEAP_SMALL_CLASSES; ++i)
+        out->small[i].allocated = out->small[i].amount = 0;
+    out->large.allocated = out->large.amount = 0;
+}
+
+void Fy_Heap_Destruct(Fy_Heap *heap) {
+    for (int i = 0; i < FY_HEAP_SMALL_CLASSES; ++i) {
+        if (heap->small[i].allocated)
+            free(heap->small[i].blocks);
+    }
+    if (heap->large.allocated)
+        free(heap->large.blocks);
+}
+
+/* Takes a never used block from the top of the heap, returns 0 if there is no room */
+static uint16_t Fy_Heap_allocateFromTop(Fy_Heap *heap, uint32_t size) {
+    uint16_t address;
+    if (heap->top + size > heap->end)
+        return 0;
+    address = (uint16_t)heap->top;
+    heap->top += size;
+    return address;
+}
+
+/* Returns the address of a block of at least `size` bytes, or 0 if there is no room */
+uint16_t Fy_Heap_allocate(Fy_Heap *heap, uint16_t size) {
+    int size_class = Fy_Heap_getSizeClass(size ? size : 1);
+    uint32_t block_size;
+    uint16_t address = 0;
+
+    if (size_class >= 0) {
+        Fy_HeapFreeList *list = &heap->small[size_class];
+        block_size = (uint32_t)FY_HEAP_GRANULE << size_class;
+        // Reuse the most recently freed block, it is probably still in cache
+        if (list->amount > 0) {
+            address = list->blocks[list->amount - 1].address;
+            Fy_Heap_removeFreeBlock(heap, address);
+        } else {
+            address = Fy_Heap_allocateFromTop(heap, block_size);
+        }
+    } else {
+        Fy_HeapFreeList *list = &heap->large;
+        size_t best = list->amount;
+        block_size = ((uint32_t)size + FY_HEAP_LARGE_UNIT - 1) / FY_HEAP_LARGE_UNIT * FY_HEAP_LARGE_UNIT;
+
+        // Best fit keeps big free blocks around for big requests
+        for (size_t i = 0; i < list->amount; ++i) {
+            if (list->blocks[i].size >= block_size && (best == list->amount || list->blocks[i].size < list->blocks[best].size))
+                best = i;
+        }
+        if (best < list->amount) {
+            Fy_HeapBlock found = list->blocks[best];
+            Fy_Heap_removeFreeBlock(heap, found.address);
+            address = found.address;
+            // Give the rest back to the free lists
+            if (found.size > block_size)
+                Fy_Heap_addFreeBlock(heap, found.address + block_size, found.size - block_size);
+        } else {
+            address = Fy_Heap_allocateFromTop(heap, block_size);
+        }
+    }
+
+    if (address != 0)
+        heap->block_sizes[address / FY_HEAP_GRANULE] = (uint16_t)block_size;
+    return address;
+}
+
+/* Returns the usable size of the block at `address`, or 0 if no allocated block starts there */
+uint16_t Fy_Heap_getBlockSize(Fy_Heap *heap, uint16_t address) {
+    if (address < heap->start || address >= heap->top || address % FY_HEAP_GRANULE != 0)
+        return 0;
+    return heap->block_sizes[address / FY_HEAP_GRANULE];
+}
+
+/* Returns false if `address` isn't an allocated block */
+bool Fy_Heap_free(Fy_Heap *heap, uint16_t address) {
+    uint16_t size = Fy_Heap_getBlockSize(heap, address);
+    uint16_t neighbour;
+
+    if (size == 0)
+        return false;
+    heap->block_sizes[address / FY_HEAP_GRANULE] = 0;
+
+    // Merge large blocks with the large free blocks around them
+    if (Fy_Heap_getSizeClass(size) < 0) {
+        uint32_t next = (uint32_t)address + size;
+        if (next < heap->top && heap->free_sizes[next / FY_HEAP_GRANULE] != 0
+            && Fy_Heap_getSizeClass(heap->free_sizes[next / FY_HEAP_GRANULE]) < 0) {
+            size += heap->free_sizes[next / FY_HEAP_GRANULE];
+            Fy_Heap_removeFreeBlock(heap, (uint16_t)next);
+        }
+        neighbour = Fy_Heap_getFreeBlockBefore(heap, address);
+        if (neighbour != 0 && Fy_Heap_getSizeClass(heap->free_sizes[neighbour / FY_HEAP_GRANULE]) < 0) {
+            size += heap->free_sizes[neighbour / FY_HEAP_GRANULE];
+            Fy_Heap_removeFreeBlock(heap, neighbour);
+            address = neighbour;
+        }
+    }
+
+    if ((uint32_t)address + size != heap->top) {
+        Fy_Heap_addFreeBlock(heap, address, size);
+        return true;
+    }
+
+    // The block at the top lowers the top, and so does every free block under it
+    heap->top = address;
+    while ((neighbour = Fy_Heap_getFreeBlockBefore(heap, heap->top)) != 0) {
+        Fy_Heap_removeFreeBlock(heap, neighbour);
+        heap->top = neighbour;
+    }
+    return true;
+}
@@ -0,0 +1,53 @@
+#ifndef FY_HEAP_H
+#define FY_HEAP_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Every block starts on a granule and is a whole number of granules */
+#define FY_HEAP_GRANULE 8
+/* Small blocks are powers of 2 from FY_HEAP_GRANULE up to FY_HEAP_GRANULE << (FY_HEAP_SMALL_CLASSES - 1) */
+#define FY_HEAP_SMALL_CLASSES 8
+/* Bigger blocks are multiples of this */
+#define FY_HEAP_LARGE_UNIT 1024
+
+typedef struct Fy_HeapBlock Fy_HeapBlock;
+typedef struct Fy_HeapFreeList Fy_HeapFreeList;
+typedef struct Fy_Heap Fy_Heap;
+
+struct Fy_HeapBlock {
+    uint16_t address;
+    uint16_t size;
+};
+
+struct Fy_HeapFreeList {
+    Fy_HeapBlock *blocks;
+    size_t amount, allocated;
+};
+
+/*
+ * Allocator for a region of guest memory.
+ * All bookkeeping is kept on the host so programs can't corrupt it.
+ */
+struct Fy_Heap {
+    /* Region is [start, end), memory above `top` was never handed out */
+    uint32_t start, end, top;
+    /* Size of the allocated block starting at each granule, 0 if no block starts there */
+    uint16_t block_sizes[(1 << 16) / FY_HEAP_GRANULE];
+    /* Size of the free block starting at each granule and its index in its free list */
+    uint16_t free_sizes[(1 << 16) / FY_HEAP_GRANULE];
+    uint16_t free_indices[(1 << 16) / FY_HEAP_GRANULE];
+    /* Address of each free block, kept at its last granule so the free block before an address can be found */
+    uint16_t free_starts[(1 << 16) / FY_HEAP_GRANULE];
+    Fy_HeapFreeList small[FY_HEAP_SMALL_CLASSES];
+    Fy_HeapFreeList large;
+};
+
+void Fy_Heap_Init(Fy_Heap *out, uint32_t start, uint32_t end);
+void Fy_Heap_Destruct(Fy_Heap *heap);
+uint16_t Fy_Heap_allocate(Fy_Heap *heap, uint16_t size);
+uint16_t Fy_Heap_getBlockSize(Fy_Heap *heap, uint16_t address);
+bool Fy_Heap_free(Fy_Heap *heap, uint16_t address);
+
+#endif /* FY_HEAP_H */
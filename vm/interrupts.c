@@ -9,6 +9,48 @@ static void Fy_interruptUpdate_run(Fy_VM *vm);
 static void Fy_interruptGetTime_run(Fy_VM *vm);
 static void Fy_interruptGetKeyboardInput_run(Fy_VM *vm);
 static void Fy_interruptGetRandom_run(Fy_VM *vm);
+static void Fy_interruptSleep_run(Fy_VM *vm);
+static void Fy_interruptWaitForInput_run(Fy_VM *vm);
+static void Fy_interruptSetTimerHandler_run(Fy_VM *vm);
+static void Fy_interruptSetKeyboardHandler_run(Fy_VM *vm);
+static void Fy_interruptWaitForInterrupt_run(Fy_VM *vm);
+static void Fy_interruptSeedRandom_run(Fy_VM *vm);
+static void Fy_interruptFillRandom_run(Fy_VM *vm);
+static void Fy_interruptFlushOutput_run(Fy_VM *vm);
+static void Fy_interruptStringLength_run(Fy_VM *vm);
+static void Fy_interruptStringCompare_run(Fy_VM *vm);
+static void Fy_interruptFindByte_run(Fy_VM *vm);
+static void Fy_interruptNumberToString_run(Fy_VM *vm);
+static void Fy_interruptStringToNumber_run(Fy_VM *vm);
+static void Fy_interruptSort_run(Fy_VM *vm);
+static void Fy_interruptBinarySearch_run(Fy_VM *vm);
+static void Fy_interruptChecksum_run(Fy_VM *vm);
+static void Fy_interruptHashtableCreate_run(Fy_VM *vm);
+static void Fy_interruptHashtableInsert_run(Fy_VM *vm);
+static void Fy_interruptHashtableLookup_run(Fy_VM *vm);
+static void Fy_interruptHashtableRemove_run(Fy_VM *vm);
+static void Fy_interruptHashtableDestroy_run(Fy_VM *vm);
+static void Fy_interruptAllocate_run(Fy_VM *vm);
+static void Fy_interruptFree_run(Fy_VM *vm);
+static void Fy_interruptReallocate_run(Fy_VM *vm);
+static void Fy_interruptBignumAdd_run(Fy_VM *vm);
+static void Fy_interruptBignumSub_run(Fy_VM *vm);
+static void Fy_interruptBignumMul_run(Fy_VM *vm);
+static void Fy_interruptBignumDiv_run(Fy_VM *vm);
+static void Fy_interruptBignumCompare_run(Fy_VM *vm);
+static void Fy_interruptBignumPrint_run(Fy_VM *vm);
+static void Fy_interruptVector_run(Fy_VM *vm);
+static void Fy_interruptFixedMath_run(Fy_VM *vm);
+static void Fy_interruptFloatMath_run(Fy_VM *vm);
+static void Fy_interruptFillRect_run(Fy_VM *vm);
+static void Fy_interruptHorizontalLine_run(Fy_VM *vm);
+static void Fy_interruptVerticalLine_run(Fy_VM *vm);
+static void Fy_interruptClearScreen_run(Fy_VM *vm);
+static void Fy_interruptBlit_run(Fy_VM *vm);
+static void Fy_interruptMapFramebuffer_run(Fy_VM *vm);
+static void Fy_interruptOpenScaledWindow_run(Fy_VM *vm);
+static void Fy_interruptLoadTiles_run(Fy_VM *vm);
+static void Fy_interruptDrawScene_run(Fy_VM *vm);
 
 Fy_InterruptRunFunc Fy_interruptFuncs[] = {
     Fy_interruptPutNumber_run,
@@ -19,97 +61,142 @@ Fy_InterruptRunFunc Fy_interruptFuncs[] = {
     Fy_interruptUpdate_run,
     Fy_interruptGetTime_run,
     Fy_interruptGetKeyboardInput_run,
-    Fy_interruptGetRandom_run
-};
-
-SDL_Color Fy_screenPalette[] = {
-    { 0xff, 0xff, 0xff, 0xff },
-    { 0, 0, 0, 0xff },
-    { 0xff, 0, 0, 0xff },
-    { 0, 0xff, 0, 0xff },
-    { 0, 0, 0xff, 0xff }
+    Fy_interruptGetRandom_run,
+    Fy_interruptSleep_run,
+    Fy_interruptWaitForInput_run,
+    Fy_interruptSetTimerHandler_run,
+    Fy_interruptSetKeyboardHandler_run,
+    Fy_interruptWaitForInterrupt_run,
+    Fy_interruptSeedRandom_run,
+    Fy_interruptFillRandom_run,
+    Fy_interruptFlushOutput_run,
+    Fy_interruptStringLength_run,
+    Fy_interruptStringCompare_run,
+    Fy_interruptFindByte_run,
+    Fy_interruptNumberToString_run,
+    Fy_interruptStringToNumber_run,
+    Fy_interruptSort_run,
+    Fy_interruptBinarySearch_run,
+    Fy_interruptChecksum_run,
+    Fy_interruptHashtableCreate_run,
+    Fy_interruptHashtableInsert_run,
+    Fy_interruptHashtableLookup_run,
+    Fy_interruptHashtableRemove_run,
+    Fy_interruptHashtableDestroy_run,
+    Fy_interruptAllocate_run,
+    Fy_interruptFree_run,
+    Fy_interruptReallocate_run,
+    Fy_interruptBignumAdd_run,
+    Fy_interruptBignumSub_run,
+    Fy_interruptBignumMul_run,
+    Fy_interruptBignumDiv_run,
+    Fy_interruptBignumCompare_run,
+    Fy_interruptBignumPrint_run,
+    Fy_interruptVector_run,
+    Fy_interruptFixedMath_run,
+    Fy_interruptFloatMath_run,
+    Fy_interruptFillRect_run,
+    Fy_interruptHorizontalLine_run,
+    Fy_interruptVerticalLine_run,
+    Fy_interruptClearScreen_run,
+    Fy_interruptBlit_run,
+    Fy_interruptMapFramebuffer_run,
+    Fy_interruptOpenScaledWindow_run,
+    Fy_interruptLoadTiles_run,
+    Fy_interruptDrawScene_run
 };
 
 static void Fy_interruptPutNumber_run(Fy_VM *vm) {
     uint16_t number;
     Fy_VM_getReg16(vm, Fy_Reg16_Ax, &number);
-    printf("%d", number);
+    Fy_Output_writeNumber(&vm->output, number);
 }
 
 static void Fy_interruptPutChar_run(Fy_VM *vm) {
     uint8_t c;
     Fy_VM_getReg8(vm, Fy_Reg8_Al, &c);
-    printf("%c", c);
+    Fy_Output_writeChar(&vm->output, (char)c);
+}
+
+/* Gets the length of the string at `address`, causing a runtime error if it isn't terminated */
+static bool Fy_getGuestStringLength(Fy_VM *vm, uint16_t address, uint16_t *out) {
+    if (!Fy_VM_getStringLength(vm, address, out)) {
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_InterruptError, "string at %.4X has no NUL", address);
+        return false;
+    }
+    return true;
 }
 
 static void Fy_interruptPutString_run(Fy_VM *vm) {
-    uint16_t addr;
-    uint16_t i = 0;
-    uint8_t c;
+    uint16_t addr, length;
+    uint32_t until_wrap;
     Fy_VM_getReg16(vm, Fy_Reg16_Ax, &addr);
-    do {
-        c = Fy_VM_getMem8(vm, addr + i);
-        putchar(c);
-        ++i;
-    } while (c != 0); // Until reached NUL
-}
 
-static void Fy_interruptOpenWindow_run(Fy_VM *vm) {
-    uint8_t width;
-    uint8_t height;
-    SDL_Window *window;
-    SDL_Surface *surface;
+    if (!Fy_getGuestStringLength(vm, addr, &length))
+        return;
+
+    // Write the string, continuing from address 0 if it wraps around memory
+    until_wrap = (1 << 16) - (uint32_t)addr;
+    if (length <= until_wrap) {
+        Fy_Output_write(&vm->output, (char*)&vm->mem_space_bottom[addr], length);
+    } else {
+        Fy_Output_write(&vm->output, (char*)&vm->mem_space_bottom[addr], until_wrap);
+        Fy_Output_write(&vm->output, (char*)vm->mem_space_bottom, length - until_wrap);
+    }
+}
 
-    if (vm->window) {
+/* Opens a window of `width` by `height` pixels, each shown as `scale` by `scale` pixels */
+static void Fy_openWindow(Fy_VM *vm, int width, int height, int scale) {
+    if (Fy_Screen_isOpen(&vm->screen)) {
         Fy_VM_runtimeError(vm, Fy_RuntimeError_InterruptError, "Window reopened");
         return;
     }
 
+    if (!Fy_Screen_open(&vm->screen, width, height, scale))
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_InterruptError, "Window could not be opened");
+}
+
+static void Fy_interruptOpenWindow_run(Fy_VM *vm) {
+    uint8_t width;
+    uint8_t height;
+
     Fy_VM_getReg8(vm, Fy_Reg8_Ah, &width);
     Fy_VM_getReg8(vm, Fy_Reg8_Al, &height);
 
-    SDL_Init(SDL_INIT_VIDEO);
-    window = SDL_CreateWindow("Fytecode window", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, (int)width, (int)height, SDL_WINDOW_SHOWN);
-    if (!window) {
-        Fy_VM_runtimeError(vm, Fy_RuntimeError_InterruptError, "Window could not be opened");
-        return;
-    }
+    Fy_openWindow(vm, (int)width, (int)height, 1);
+}
 
-    surface = SDL_GetWindowSurface(window);
-    vm->window = window;
-    vm->surface = surface;
+/* Causes a runtime error if there is no window to draw on or `color` isn't in the palette */
+static bool Fy_checkCanDraw(Fy_VM *vm, uint16_t color) {
+    if (!Fy_Screen_isOpen(&vm->screen)) {
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_InterruptError, "no window to draw on");
+        return false;
+    }
+    if (!Fy_Screen_isValidColor(color)) {
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_InterruptError, "color '%d' invalid", color);
+        return false;
+    }
+    return true;
 }
 
 static void Fy_interruptSetPixel_run(Fy_VM *vm) {
     uint8_t x;
     uint8_t y;
-    uint8_t color_id;
-    SDL_Color color;
-    int screen_width, screen_height;
-    uint8_t *base;
+    uint8_t color;
 
     Fy_VM_getReg8(vm, Fy_Reg8_Ah, &x);
     Fy_VM_getReg8(vm, Fy_Reg8_Al, &y);
-    Fy_VM_getReg8(vm, Fy_Reg8_Bl, &color_id);
+    Fy_VM_getReg8(vm, Fy_Reg8_Bl, &color);
 
-    if (color_id > sizeof(Fy_screenPalette) / sizeof(SDL_Color)) {
-        Fy_VM_runtimeError(vm, Fy_RuntimeError_InterruptError, "color '%d' invalid", color_id);
+    if (!Fy_checkCanDraw(vm, color))
         return;
-    }
 
-    SDL_GetWindowSize(vm->window, &screen_width, &screen_height);
-
-    if (x >= (uint8_t)screen_width || y >= (uint8_t)screen_height) {
+    if (!Fy_Screen_containsPixel(&vm->screen, x, y)) {
         Fy_VM_runtimeError(vm, Fy_RuntimeError_PixelNotInScreen, "(%d, %d)", x, y);
         return;
     }
 
-    color = Fy_screenPalette[color_id];
-    base = &((uint8_t*)vm->surface->pixels)[vm->surface->pitch * y + x * vm->surface->format->BytesPerPixel];
-    base[0] = color.r;
-    base[1] = color.g;
-    base[2] = color.b;
-    base[3] = color.a;
+    Fy_Screen_setPixel(&vm->screen, x, y, color);
 }
 
 static void Fy_interruptGetTime_run(Fy_VM *vm) {
@@ -129,11 +216,921 @@ static void Fy_interruptGetKeyboardInput_run(Fy_VM *vm) {
 }
 
 static void Fy_interruptGetRandom_run(Fy_VM *vm) {
-    Fy_VM_setReg16(vm, Fy_Reg16_Ax, Fy_VM_generateRandom(vm));
+    Fy_VM_setReg16(vm, Fy_Reg16_Ax, Fy_Random_next16(&vm->random));
+}
+
+/* Restarts the random sequence from the 32-bit seed `bx:ax` */
+static void Fy_interruptSeedRandom_run(Fy_VM *vm) {
+    uint16_t low, high;
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &low);
+    Fy_VM_getReg16(vm, Fy_Reg16_Bx, &high);
+    Fy_Random_Init(&vm->random, ((uint32_t)high << 16) | low);
+}
+
+/* Fills `cx` words starting at address `ax` with random values */
+static void Fy_interruptFillRandom_run(Fy_VM *vm) {
+    uint16_t address, amount;
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &address);
+    Fy_VM_getReg16(vm, Fy_Reg16_Cx, &amount);
+
+    // Every 32-bit output gives two words
+    while (amount >= 2) {
+        uint32_t value = Fy_Random_next32(&vm->random);
+        Fy_VM_setMem16(vm, address, (uint16_t)value);
+        Fy_VM_setMem16(vm, address + 2, (uint16_t)(value >> 16));
+        address += 4;
+        amount -= 2;
+    }
+    if (amount == 1)
+        Fy_VM_setMem16(vm, address, Fy_Random_next16(&vm->random));
+}
+
+/* Sleeps for `ax` milliseconds, or until the window is closed */
+static void Fy_interruptSleep_run(Fy_VM *vm) {
+    uint16_t milliseconds;
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &milliseconds);
+    Fy_VM_sleep(vm, milliseconds);
+}
+
+/* Waits up to `ax` milliseconds for a key press, sets `ax` to 1 if a key is waiting to be read by int 7 */
+static void Fy_interruptWaitForInput_run(Fy_VM *vm) {
+    uint16_t timeout;
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &timeout);
+    if (!vm->keyboard.has_key)
+        Fy_VM_waitForInput(vm, timeout);
+    Fy_VM_setReg16(vm, Fy_Reg16_Ax, vm->keyboard.has_key ? 1 : 0);
+}
+
+/* Calls the handler at label `ax` every `bx` milliseconds, a period of 0 removes the handler */
+static void Fy_interruptSetTimerHandler_run(Fy_VM *vm) {
+    uint16_t handler, period;
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &handler);
+    Fy_VM_getReg16(vm, Fy_Reg16_Bx, &period);
+    vm->irq.has_timer_handler = period != 0;
+    vm->irq.timer_handler = handler;
+    vm->irq.timer_period = period;
+    vm->irq.timer_deadline = Fy_Time_getMonotonicMilliseconds() + period;
+    vm->irq.timer_countdown = FY_VM_TIMER_CHECK_INTERVAL;
+}
+
+/* Calls the handler at label `ax` when a key is pressed if `bx` is non-zero, the handler should read the key with int 7 */
+static void Fy_interruptSetKeyboardHandler_run(Fy_VM *vm) {
+    uint16_t handler, enable;
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &handler);
+    Fy_VM_getReg16(vm, Fy_Reg16_Bx, &enable);
+    vm->irq.has_keyboard_handler = enable != 0;
+    vm->irq.keyboard_handler = handler;
+}
+
+/* Sleeps until a timer or keyboard handler is due */
+static void Fy_interruptWaitForInterrupt_run(Fy_VM *vm) {
+    Fy_VM_waitForInterrupt(vm);
+}
+
+/* Writes the buffered console output now */
+static void Fy_interruptFlushOutput_run(Fy_VM *vm) {
+    Fy_Output_flush(&vm->output);
+}
+
+/* Sets `ax` to the length of the string at `ax` */
+static void Fy_interruptStringLength_run(Fy_VM *vm) {
+    uint16_t address, length;
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &address);
+    if (!Fy_getGuestStringLength(vm, address, &length))
+        return;
+    Fy_VM_setReg16(vm, Fy_Reg16_Ax, length);
+}
+
+/* Compares the strings at `ax` and `bx`, sets `ax` to -1, 0 or 1 like strcmp */
+static void Fy_interruptStringCompare_run(Fy_VM *vm) {
+    uint16_t address1, address2, length1, length2;
+    uint32_t length, mismatch;
+    int16_t result = 0;
+
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &address1);
+    Fy_VM_getReg16(vm, Fy_Reg16_Bx, &address2);
+    if (!Fy_getGuestStringLength(vm, address1, &length1) || !Fy_getGuestStringLength(vm, address2, &length2))
+        return;
+
+    // Include the NUL of the shorter string so a prefix compares as smaller
+    length = (uint32_t)(length1 < length2 ? length1 : length2) + 1;
+    mismatch = Fy_VM_compareMem(vm, address1, address2, length);
+    if (mismatch < length)
+        result = Fy_VM_getMem8(vm, address1 + mismatch) < Fy_VM_getMem8(vm, address2 + mismatch) ? -1 : 1;
+
+    Fy_VM_setReg16(vm, Fy_Reg16_Ax, (uint16_t)result);
+}
+
+/* Looks for `bl` in `cx` bytes from `ax`, sets `ax` to whether it was found and `bx` to its address */
+static void Fy_interruptFindByte_run(Fy_VM *vm) {
+    uint16_t address, length, found_address = 0;
+    uint8_t value;
+    bool found;
+
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &address);
+    Fy_VM_getReg8(vm, Fy_Reg8_Bl, &value);
+    Fy_VM_getReg16(vm, Fy_Reg16_Cx, &length);
+
+    found = Fy_VM_findByte(vm, address, value, length, &found_address);
+    Fy_VM_setReg16(vm, Fy_Reg16_Bx, found_address);
+    Fy_VM_setReg16(vm, Fy_Reg16_Ax, found ? 1 : 0);
+}
+
+/* Writes `ax` as a decimal string to `bx` (signed if `cx` is non-zero), sets `ax` to the length without the NUL */
+static void Fy_interruptNumberToString_run(Fy_VM *vm) {
+    uint16_t value, address, is_signed;
+    char digits[7];
+    int length;
+
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &value);
+    Fy_VM_getReg16(vm, Fy_Reg16_Bx, &address);
+    Fy_VM_getReg16(vm, Fy_Reg16_Cx, &is_signed);
+
+    if (is_signed)
+        length = sprintf(digits, "%d", (int)(int16_t)value);
+    else
+        length = sprintf(digits, "%u", (unsigned int)value);
+
+    Fy_VM_writeMemFrom(vm, address, (uint8_t*)digits, length + 1);
+    Fy_VM_setReg16(vm, Fy_Reg16_Ax, (uint16_t)length);
+}
+
+/*
+ * Parses a decimal number with an optional sign from the string at `ax`.
+ * Sets `ax` to the value (modulo 2^16) and `bx` to the amount of characters used, 0 if there was no number.
+ */
+static void Fy_interruptStringToNumber_run(Fy_VM *vm) {
+    uint16_t address, idx = 0, value = 0;
+    bool negative = false;
+    uint8_t c;
+
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &address);
+
+    c = Fy_VM_getMem8(vm, address);
+    if (c == '-' || c == '+') {
+        negative = c == '-';
+        c = Fy_VM_getMem8(vm, address + ++idx);
+    }
+    if (!isdigit(c)) {
+        Fy_VM_setReg16(vm, Fy_Reg16_Ax, 0);
+        Fy_VM_setReg16(vm, Fy_Reg16_Bx, 0);
+        return;
+    }
+    // Stop before the index wraps in case all of memory is digits
+    while (isdigit(c) && idx < 0xffff) {
+        value = value * 10 + (c - '0');
+        c = Fy_VM_getMem8(vm, address + ++idx);
+    }
+
+    Fy_VM_setReg16(vm, Fy_Reg16_Bx, idx);
+    Fy_VM_setReg16(vm, Fy_Reg16_Ax, negative ? (uint16_t)-value : value);
+}
+
+/* Sorts `cx` elements at `ax` in place, `bl` holds FY_ALGORITHM_WORDS and FY_ALGORITHM_SIGNED */
+static void Fy_interruptSort_run(Fy_VM *vm) {
+    uint16_t address, count;
+    uint8_t flags;
+
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &address);
+    Fy_VM_getReg16(vm, Fy_Reg16_Cx, &count);
+    Fy_VM_getReg8(vm, Fy_Reg8_Bl, &flags);
+
+    if (flags & FY_ALGORITHM_WORDS) {
+        uint16_t *words = malloc(count * sizeof(uint16_t));
+        for (uint16_t i = 0; i < count; ++i)
+            words[i] = Fy_VM_getMem16(vm, address + i * 2);
+        Fy_Algorithm_sortWords(words, count, flags & FY_ALGORITHM_SIGNED);
+        for (uint16_t i = 0; i < count; ++i)
+            Fy_VM_setMem16(vm, address + i * 2, words[i]);
+        free(words);
+    } else {
+        uint8_t *bytes = malloc(count * sizeof(uint8_t));
+        Fy_VM_readMemInto(vm, address, bytes, count);
+        Fy_Algorithm_sortBytes(bytes, count, flags & FY_ALGORITHM_SIGNED);
+        Fy_VM_writeMemFrom(vm, address, bytes, count);
+        free(bytes);
+    }
+}
+
+/*
+ * Binary searches `cx` sorted elements at `ax` for `dx` (`dl` for bytes), `bl` holds the array flags like in int 22.
+ * Sets `ax` to whether it was found and `bx` to its index, or to the index it would be inserted at.
+ */
+static void Fy_interruptBinarySearch_run(Fy_VM *vm) {
+    uint16_t address, count, key;
+    uint16_t low, high;
+    uint16_t flip;
+    uint8_t flags;
+    bool words;
+
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &address);
+    Fy_VM_getReg16(vm, Fy_Reg16_Cx, &count);
+    Fy_VM_getReg16(vm, Fy_Reg16_Dx, &key);
+    Fy_VM_getReg8(vm, Fy_Reg8_Bl, &flags);
+
+    words = flags & FY_ALGORITHM_WORDS;
+    if (!words)
+        key &= 0xff;
+    // Flipping the sign bit orders signed values as unsigned ones
+    flip = !(flags & FY_ALGORITHM_SIGNED) ? 0 : words ? 0x8000 : 0x80;
+    key ^= flip;
+
+    low = 0;
+    high = count;
+    while (low < high) {
+        uint16_t middle = low + (high - low) / 2;
+        uint16_t value = words ? Fy_VM_getMem16(vm, address + middle * 2) : Fy_VM_getMem8(vm, address + middle);
+        if ((uint16_t)(value ^ flip) < key)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    Fy_VM_setReg16(vm, Fy_Reg16_Bx, low);
+    if (low < count) {
+        uint16_t value = words ? Fy_VM_getMem16(vm, address + low * 2) : Fy_VM_getMem8(vm, address + low);
+        Fy_VM_setReg16(vm, Fy_Reg16_Ax, (uint16_t)(value ^ flip) == key ? 1 : 0);
+    } else {
+        Fy_VM_setReg16(vm, Fy_Reg16_Ax, 0);
+    }
+}
+
+/* Checksums `cx` bytes at `ax` with the algorithm in `bl` (0 is CRC-32, 1 is FNV-1a), the result goes in `dx:ax` */
+static void Fy_interruptChecksum_run(Fy_VM *vm) {
+    uint16_t address, length;
+    uint8_t algorithm;
+    uint32_t result;
+    uint32_t until_wrap;
+    uint8_t *start;
+
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &address);
+    Fy_VM_getReg16(vm, Fy_Reg16_Cx, &length);
+    Fy_VM_getReg8(vm, Fy_Reg8_Bl, &algorithm);
+
+    // Checksum the range in up to two parts if it wraps around memory
+    start = &vm->mem_space_bottom[address];
+    until_wrap = (1 << 16) - (uint32_t)address;
+    if (until_wrap > length)
+        until_wrap = length;
+
+    switch (algorithm) {
+    case FY_ALGORITHM_CRC32:
+        result = Fy_Algorithm_crc32(FY_CRC32_INIT, start, until_wrap);
+        result = Fy_Algorithm_crc32(result, vm->mem_space_bottom, length - until_wrap);
+        break;
+    case FY_ALGORITHM_FNV1A32:
+        result = Fy_Algorithm_fnv1a32(FY_FNV1A32_INIT, start, until_wrap);
+        result = Fy_Algorithm_fnv1a32(result, vm->mem_space_bottom, length - until_wrap);
+        break;
+    default:
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_InterruptError, "checksum '%d' invalid", algorithm);
+        return;
+    }
+
+    Fy_VM_setReg16(vm, Fy_Reg16_Ax, (uint16_t)result);
+    Fy_VM_setReg16(vm, Fy_Reg16_Dx, (uint16_t)(result >> 16));
+}
+
+/* Hash table interrupts take the table handle in `ax` and the key in `bx`, which is an address for string tables */
+
+/* Gets the table referred to by `ax`, causing a runtime error if there is none */
+static Fy_Hashtable *Fy_getGuestHashtable(Fy_VM *vm) {
+    uint16_t handle;
+    Fy_Hashtable *table;
+
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &handle);
+    table = Fy_Hashtables_get(&vm->hashtables, handle);
+    if (!table)
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_InterruptError, "hash table '%d' invalid", handle);
+    return table;
+}
+
+/* Reads the key in `bx`, a string key that wraps around memory is copied to `*copy` which should be freed */
+static bool Fy_getGuestHashtableKey(Fy_VM *vm, Fy_Hashtable *table, Fy_HashtableKey *out, uint8_t **copy) {
+    uint16_t key;
+
+    *copy = NULL;
+    Fy_VM_getReg16(vm, Fy_Reg16_Bx, &key);
+    out->word = key;
+    out->string = NULL;
+    out->length = 0;
+    if (table->key_type != Fy_HashtableKeyType_String)
+        return true;
+
+    if (!Fy_getGuestStringLength(vm, key, &out->length))
+        return false;
+    if ((uint32_t)key + out->length <= (1 << 16)) {
+        out->string = &vm->mem_space_bottom[key];
+    } else {
+        *copy = malloc(out->length * sizeof(uint8_t));
+        Fy_VM_readMemInto(vm, key, *copy, out->length);
+        out->string = *copy;
+    }
+    return true;
+}
+
+/* Creates a table with word keys if `al` is 0 or string keys if it is 1, sets `ax` to its handle or 0 on failure */
+static void Fy_interruptHashtableCreate_run(Fy_VM *vm) {
+    uint8_t key_type;
+
+    Fy_VM_getReg8(vm, Fy_Reg8_Al, &key_type);
+    if (key_type > 1) {
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_InterruptError, "key type '%d' invalid", key_type);
+        return;
+    }
+    Fy_VM_setReg16(vm, Fy_Reg16_Ax, Fy_Hashtables_create(&vm->hashtables,
+                    key_type ? Fy_HashtableKeyType_String : Fy_HashtableKeyType_Word));
+}
+
+/* Sets the value of the key to `dx`, sets `ax` to 1 on success or 0 if out of memory */
+static void Fy_interruptHashtableInsert_run(Fy_VM *vm) {
+    Fy_Hashtable *table;
+    Fy_HashtableKey key;
+    uint8_t *copy;
+    uint16_t value;
+    bool success;
+
+    if (!(table = Fy_getGuestHashtable(vm)) || !Fy_getGuestHashtableKey(vm, table, &key, &copy))
+        return;
+    Fy_VM_getReg16(vm, Fy_Reg16_Dx, &value);
+    success = Fy_Hashtables_insert(&vm->hashtables, table, &key, value);
+    free(copy);
+    Fy_VM_setReg16(vm, Fy_Reg16_Ax, success ? 1 : 0);
+}
+
+/* Sets `ax` to whether the key was found and `dx` to its value */
+static void Fy_interruptHashtableLookup_run(Fy_VM *vm) {
+    Fy_Hashtable *table;
+    Fy_HashtableKey key;
+    uint8_t *copy;
+    uint16_t value = 0;
+    bool found;
+
+    if (!(table = Fy_getGuestHashtable(vm)) || !Fy_getGuestHashtableKey(vm, table, &key, &copy))
+        return;
+    found = Fy_Hashtable_lookup(table, &key, &value);
+    free(copy);
+    Fy_VM_setReg16(vm, Fy_Reg16_Dx, value);
+    Fy_VM_setReg16(vm, Fy_Reg16_Ax, found ? 1 : 0);
+}
+
+/* Removes the key, sets `ax` to whether it was found */
+static void Fy_interruptHashtableRemove_run(Fy_VM *vm) {
+    Fy_Hashtable *table;
+    Fy_HashtableKey key;
+    uint8_t *copy;
+    bool found;
+
+    if (!(table = Fy_getGuestHashtable(vm)) || !Fy_getGuestHashtableKey(vm, table, &key, &copy))
+        return;
+    found = Fy_Hashtables_remove(&vm->hashtables, table, &key);
+    free(copy);
+    Fy_VM_setReg16(vm, Fy_Reg16_Ax, found ? 1 : 0);
+}
+
+/* Frees the table, its handle may be reused */
+static void Fy_interruptHashtableDestroy_run(Fy_VM *vm) {
+    uint16_t handle;
+
+    if (!Fy_getGuestHashtable(vm))
+        return;
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &handle);
+    Fy_Hashtables_destroy(&vm->hashtables, handle);
+}
+
+/* Allocates `cx` bytes above the stack, sets `ax` to the address or 0 if there is no room */
+static void Fy_interruptAllocate_run(Fy_VM *vm) {
+    uint16_t size;
+    Fy_VM_getReg16(vm, Fy_Reg16_Cx, &size);
+    Fy_VM_setReg16(vm, Fy_Reg16_Ax, Fy_Heap_allocate(&vm->heap, size));
+}
+
+/* Frees the block at `ax`, freeing 0 does nothing */
+static void Fy_interruptFree_run(Fy_VM *vm) {
+    uint16_t address;
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &address);
+    if (address != 0 && !Fy_Heap_free(&vm->heap, address))
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_InterruptError, "%.4X isn't an allocated block", address);
+}
+
+/*
+ * Resizes the block at `ax` to `cx` bytes keeping its contents, sets `ax` to the new address.
+ * On failure `ax` is set to 0 and the old block stays allocated.
+ */
+static void Fy_interruptReallocate_run(Fy_VM *vm) {
+    uint16_t address, size, old_size, new_address;
+
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &address);
+    Fy_VM_getReg16(vm, Fy_Reg16_Cx, &size);
+
+    if (address == 0) {
+        Fy_VM_setReg16(vm, Fy_Reg16_Ax, Fy_Heap_allocate(&vm->heap, size));
+        return;
+    }
+    if ((old_size = Fy_Heap_getBlockSize(&vm->heap, address)) == 0) {
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_InterruptError, "%.4X isn't an allocated block", address);
+        return;
+    }
+    // Blocks are rounded up, so it may already fit
+    if (size <= old_size && size > old_size / 2)
+        return;
+
+    if ((new_address = Fy_Heap_allocate(&vm->heap, size)) == 0) {
+        Fy_VM_setReg16(vm, Fy_Reg16_Ax, 0);
+        return;
+    }
+    Fy_VM_copyMem(vm, new_address, address, size < old_size ? size : old_size);
+    Fy_Heap_free(&vm->heap, address);
+    Fy_VM_setReg16(vm, Fy_Reg16_Ax, new_address);
+}
+
+/*
+ * Bignum interrupts work on unsigned numbers of `cx` words stored least significant word first.
+ * `ax` is the destination, `bx` and `dx` are the operands and `ax` is set to the status.
+ */
+
+/* Copies the `count` words at `address` into a new host buffer, packed two to a limb */
+static uint32_t *Fy_readGuestNumber(Fy_VM *vm, uint16_t address, size_t count) {
+    size_t limbs = FY_BIGNUM_LIMBS(count);
+    uint32_t *number = calloc(limbs ? limbs : 1, sizeof(uint32_t));
+    for (size_t i = 0; i < count; ++i)
+        number[i / 2] |= (uint32_t)Fy_VM_getMem16(vm, (uint16_t)(address + i * 2)) << (i % 2 * 16);
+    return number;
+}
+
+static void Fy_writeGuestNumber(Fy_VM *vm, uint16_t address, uint32_t *number, size_t count) {
+    for (size_t i = 0; i < count; ++i)
+        Fy_VM_setMem16(vm, (uint16_t)(address + i * 2), (uint16_t)(number[i / 2] >> (i % 2 * 16)));
+}
+
+/* Runs an add or sub on the guest operands and sets `ax` to the carry/borrow */
+static void Fy_runBignumAddSub(Fy_VM *vm, uint32_t (*func)(uint32_t*, const uint32_t*, const uint32_t*, size_t)) {
+    uint16_t dest, lhs_address, rhs_address, count;
+    uint32_t *lhs, *rhs;
+    size_t limbs;
+    uint32_t carry;
+
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &dest);
+    Fy_VM_getReg16(vm, Fy_Reg16_Bx, &lhs_address);
+    Fy_VM_getReg16(vm, Fy_Reg16_Dx, &rhs_address);
+    Fy_VM_getReg16(vm, Fy_Reg16_Cx, &count);
+
+    limbs = FY_BIGNUM_LIMBS(count);
+    lhs = Fy_readGuestNumber(vm, lhs_address, count);
+    rhs = Fy_readGuestNumber(vm, rhs_address, count);
+    carry = func(lhs, lhs, rhs, limbs);
+    // With an odd amount of words the carry or borrow out of the top word stays in the high half of the top limb
+    if (count % 2 == 1)
+        carry = (lhs[limbs - 1] >> 16) != 0;
+    Fy_writeGuestNumber(vm, dest, lhs, count);
+    free(lhs);
+    free(rhs);
+
+    Fy_VM_setReg16(vm, Fy_Reg16_Ax, (uint16_t)carry);
+}
+
+/* `ax` = `bx` + `dx`, sets `ax` to the carry */
+static void Fy_interruptBignumAdd_run(Fy_VM *vm) {
+    Fy_runBignumAddSub(vm, Fy_Bignum_add);
+}
+
+/* `ax` = `bx` - `dx`, sets `ax` to the borrow */
+static void Fy_interruptBignumSub_run(Fy_VM *vm) {
+    Fy_runBignumAddSub(vm, Fy_Bignum_sub);
+}
+
+/* `ax` = `bx` * `dx`, the destination is `cx * 2` words long. Sets `ax` to 0 */
+static void Fy_interruptBignumMul_run(Fy_VM *vm) {
+    uint16_t dest, lhs_address, rhs_address, count;
+    uint32_t *lhs, *rhs, *product;
+    size_t limbs;
+
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &dest);
+    Fy_VM_getReg16(vm, Fy_Reg16_Bx, &lhs_address);
+    Fy_VM_getReg16(vm, Fy_Reg16_Dx, &rhs_address);
+    Fy_VM_getReg16(vm, Fy_Reg16_Cx, &count);
+
+    limbs = FY_BIGNUM_LIMBS(count);
+    lhs = Fy_readGuestNumber(vm, lhs_address, count);
+    rhs = Fy_readGuestNumber(vm, rhs_address, count);
+    product = malloc((limbs * 2 + 1) * sizeof(uint32_t));
+    Fy_Bignum_mul(product, lhs, rhs, limbs);
+    Fy_writeGuestNumber(vm, dest, product, (size_t)count * 2);
+    free(lhs);
+    free(rhs);
+    free(product);
+
+    Fy_VM_setReg16(vm, Fy_Reg16_Ax, 0);
+}
+
+/* `ax` = `bx` / `dx`, the remainder replaces `bx`. Sets `ax` to 1 when dividing by zero, leaving memory untouched */
+static void Fy_interruptBignumDiv_run(Fy_VM *vm) {
+    uint16_t dest, lhs_address, rhs_address, count;
+    uint32_t *lhs, *rhs, *quotient, *remainder;
+    size_t limbs;
+    bool success;
+
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &dest);
+    Fy_VM_getReg16(vm, Fy_Reg16_Bx, &lhs_address);
+    Fy_VM_getReg16(vm, Fy_Reg16_Dx, &rhs_address);
+    Fy_VM_getReg16(vm, Fy_Reg16_Cx, &count);
+
+    limbs = FY_BIGNUM_LIMBS(count);
+    lhs = Fy_readGuestNumber(vm, lhs_address, count);
+    rhs = Fy_readGuestNumber(vm, rhs_address, count);
+    quotient = malloc((limbs ? limbs : 1) * sizeof(uint32_t));
+    remainder = malloc((limbs ? limbs : 1) * sizeof(uint32_t));
+    success = Fy_Bignum_div(quotient, remainder, lhs, rhs, limbs);
+    if (success) {
+        Fy_writeGuestNumber(vm, dest, quotient, count);
+        Fy_writeGuestNumber(vm, lhs_address, remainder, count);
+    }
+    free(lhs);
+    free(rhs);
+    free(quotient);
+    free(remainder);
+
+    Fy_VM_setReg16(vm, Fy_Reg16_Ax, success ? 0 : 1);
+}
+
+/* Compares `bx` to `dx`, sets `ax` to -1, 0 or 1 */
+static void Fy_interruptBignumCompare_run(Fy_VM *vm) {
+    uint16_t lhs_address, rhs_address, count;
+    uint32_t *lhs, *rhs;
+    int result;
+
+    Fy_VM_getReg16(vm, Fy_Reg16_Bx, &lhs_address);
+    Fy_VM_getReg16(vm, Fy_Reg16_Dx, &rhs_address);
+    Fy_VM_getReg16(vm, Fy_Reg16_Cx, &count);
+
+    lhs = Fy_readGuestNumber(vm, lhs_address, count);
+    rhs = Fy_readGuestNumber(vm, rhs_address, count);
+    result = Fy_Bignum_compare(lhs, rhs, FY_BIGNUM_LIMBS(count));
+    free(lhs);
+    free(rhs);
+
+    Fy_VM_setReg16(vm, Fy_Reg16_Ax, (uint16_t)result);
+}
+
+/* Outputs `bx` in decimal, sets `ax` to the amount of digits */
+static void Fy_interruptBignumPrint_run(Fy_VM *vm) {
+    uint16_t address, count;
+    uint32_t *number;
+    char *digits;
+    size_t length;
+
+    Fy_VM_getReg16(vm, Fy_Reg16_Bx, &address);
+    Fy_VM_getReg16(vm, Fy_Reg16_Cx, &count);
+
+    number = Fy_readGuestNumber(vm, address, count);
+    // Even an empty number is printed as "0"
+    digits = malloc((count ? FY_BIGNUM_LIMBS(count) : 1) * 10 + 1);
+    length = Fy_Bignum_toDecimal(number, FY_BIGNUM_LIMBS(count), digits);
+    Fy_Output_write(&vm->output, digits, length);
+    free(number);
+    free(digits);
+
+    Fy_VM_setReg16(vm, Fy_Reg16_Ax, (uint16_t)length);
+}
+
+/* Returns whether `length` bytes starting at `address` fit before the end of memory */
+static bool Fy_isContiguous(uint16_t address, uint32_t length) {
+    return (uint32_t)address + length <= (1 << 16);
+}
+
+/*
+ * Runs an element-wise operator on `cx` elements, `ax` is the destination and `bx` and `dx` are the operand arrays.
+ * The low byte of `si` is the operator and the rest holds the FY_VECTOR flags, with FY_VECTOR_SCALAR `dx` itself is the rhs.
+ */
+static void Fy_interruptVector_run(Fy_VM *vm) {
+    uint16_t dest, lhs_address, rhs, count, operation;
+    Fy_VectorOperator operator;
+    uint32_t length;
+    bool is_scalar;
+
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &dest);
+    Fy_VM_getReg16(vm, Fy_Reg16_Bx, &lhs_address);
+    Fy_VM_getReg16(vm, Fy_Reg16_Dx, &rhs);
+    Fy_VM_getReg16(vm, Fy_Reg16_Cx, &count);
+    Fy_VM_getReg16(vm, Fy_Reg16_Si, &operation);
+
+    if (!Fy_Vector_isValidOperator(operation & 0xff)) {
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_InterruptError, "vector operator '%d' invalid", operation & 0xff);
+        return;
+    }
+    operator = operation & 0xff;
+    is_scalar = operation & FY_VECTOR_SCALAR;
+    length = (uint32_t)count * (operation & FY_VECTOR_WORDS ? 2 : 1);
+
+    // Common case, work on memory directly when no range wraps around memory
+    if (Fy_isContiguous(dest, length) && Fy_isContiguous(lhs_address, length) && (is_scalar || Fy_isContiguous(rhs, length))) {
+        uint8_t *mem = vm->mem_space_bottom;
+        Fy_Vector_run(operator, operation, &mem[dest], &mem[lhs_address], is_scalar ? NULL : &mem[rhs], rhs, count);
+        Fy_VM_markMemWritten(vm, dest, length);
+    } else {
+        uint8_t *lhs = malloc(length ? length : 1);
+        uint8_t *rhs_buffer = is_scalar ? NULL : malloc(length ? length : 1);
+
+        Fy_VM_readMemInto(vm, lhs_address, lhs, length);
+        if (rhs_buffer)
+            Fy_VM_readMemInto(vm, rhs, rhs_buffer, length);
+        Fy_Vector_run(operator, operation, lhs, lhs, rhs_buffer, rhs, count);
+        Fy_VM_writeMemFrom(vm, dest, lhs, length);
+        free(lhs);
+        free(rhs_buffer);
+    }
+}
+
+/* Reads the 32-bit value stored in the register pair `high_reg`:`low_reg` */
+static uint32_t Fy_getReg32(Fy_VM *vm, Fy_Reg16 high_reg, Fy_Reg16 low_reg) {
+    uint16_t high, low;
+    Fy_VM_getReg16(vm, high_reg, &high);
+    Fy_VM_getReg16(vm, low_reg, &low);
+    return ((uint32_t)high << 16) | low;
+}
+
+/*
+ * Runs a fixed-point function, the low byte of `si` is the function and the rest holds the FY_FIXED flags.
+ * 8.8 operands are in `ax` and `bx` with the result in `ax`, 16.16 operands are in `dx:ax` and `cx:bx` with the result in `dx:ax`.
+ */
+static void Fy_interruptFixedMath_run(Fy_VM *vm) {
+    uint16_t function;
+    int32_t lhs, rhs, result;
+    bool is_16_16;
+
+    Fy_VM_getReg16(vm, Fy_Reg16_Si, &function);
+    is_16_16 = function & FY_FIXED_16_16;
+    if (is_16_16) {
+        lhs = (int32_t)Fy_getReg32(vm, Fy_Reg16_Dx, Fy_Reg16_Ax);
+        rhs = (int32_t)Fy_getReg32(vm, Fy_Reg16_Cx, Fy_Reg16_Bx);
+    } else {
+        uint16_t lhs16, rhs16;
+        Fy_VM_getReg16(vm, Fy_Reg16_Ax, &lhs16);
+        Fy_VM_getReg16(vm, Fy_Reg16_Bx, &rhs16);
+        lhs = (int16_t)lhs16;
+        rhs = (int16_t)rhs16;
+    }
+
+    if (!Fy_Coprocessor_runFixed(function & 0xff, is_16_16, lhs, rhs, &result)) {
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_InterruptError, "fixed-point function '%d' invalid", function & 0xff);
+        return;
+    }
+
+    Fy_VM_setReg16(vm, Fy_Reg16_Ax, (uint16_t)result);
+    if (is_16_16)
+        Fy_VM_setReg16(vm, Fy_Reg16_Dx, (uint16_t)((uint32_t)result >> 16));
+}
+
+/*
+ * Runs a float32 operator, the low byte of `si` is the operator and the rest holds the FY_FLOAT flags.
+ * The operands are in `dx:ax` and `cx:bx` with the result in `dx:ax`, or with FY_FLOAT_MEMORY at `bx` and `dx`
+ * with the result stored at `ax`. Comparisons always set `ax` and integers take a single word.
+ */
+static void Fy_interruptFloatMath_run(Fy_VM *vm) {
+    uint16_t operation;
+    uint8_t operator;
+    uint32_t lhs, rhs, result;
+    uint16_t dest = 0;
+    bool in_memory;
+
+    Fy_VM_getReg16(vm, Fy_Reg16_Si, &operation);
+    operator = operation & 0xff;
+    in_memory = operation & FY_FLOAT_MEMORY;
+    if (in_memory) {
+        uint16_t lhs_address, rhs_address;
+        Fy_VM_getReg16(vm, Fy_Reg16_Ax, &dest);
+        Fy_VM_getReg16(vm, Fy_Reg16_Bx, &lhs_address);
+        Fy_VM_getReg16(vm, Fy_Reg16_Dx, &rhs_address);
+        // Stored like two words, the low word first
+        lhs = Fy_VM_getMem16(vm, lhs_address) | ((uint32_t)Fy_VM_getMem16(vm, lhs_address + 2) << 16);
+        rhs = Fy_VM_getMem16(vm, rhs_address) | ((uint32_t)Fy_VM_getMem16(vm, rhs_address + 2) << 16);
+    } else {
+        lhs = Fy_getReg32(vm, Fy_Reg16_Dx, Fy_Reg16_Ax);
+        rhs = Fy_getReg32(vm, Fy_Reg16_Cx, Fy_Reg16_Bx);
+    }
+
+    if (!Fy_Coprocessor_runFloat(operator, lhs, rhs, &result)) {
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_InterruptError, "float operator '%d' invalid", operator);
+        return;
+    }
+
+    if (operator == Fy_FloatOperator_Compare) {
+        Fy_VM_setReg16(vm, Fy_Reg16_Ax, (uint16_t)result);
+    } else if (in_memory) {
+        Fy_VM_setMem16(vm, dest, (uint16_t)result);
+        if (operator != Fy_FloatOperator_ToInt)
+            Fy_VM_setMem16(vm, dest + 2, (uint16_t)(result >> 16));
+    } else {
+        Fy_VM_setReg16(vm, Fy_Reg16_Ax, (uint16_t)result);
+        if (operator != Fy_FloatOperator_ToInt)
+            Fy_VM_setReg16(vm, Fy_Reg16_Dx, (uint16_t)(result >> 16));
+    }
+}
+
+/*
+ * The drawing interrupts take the top left corner in `ax` and `bx` as signed numbers, and the color in `si`.
+ * Whatever falls outside of the window is cut off.
+ */
+
+/* Fills a rectangle of `cx` by `dx` pixels */
+static void Fy_interruptFillRect_run(Fy_VM *vm) {
+    uint16_t x, y, width, height, color;
+
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &x);
+    Fy_VM_getReg16(vm, Fy_Reg16_Bx, &y);
+    Fy_VM_getReg16(vm, Fy_Reg16_Cx, &width);
+    Fy_VM_getReg16(vm, Fy_Reg16_Dx, &height);
+    Fy_VM_getReg16(vm, Fy_Reg16_Si, &color);
+
+    if (Fy_checkCanDraw(vm, color))
+        Fy_Screen_fillRect(&vm->screen, (int16_t)x, (int16_t)y, width, height, (uint8_t)color);
+}
+
+/* Draws a line of `cx` pixels to the right */
+static void Fy_interruptHorizontalLine_run(Fy_VM *vm) {
+    uint16_t x, y, length, color;
+
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &x);
+    Fy_VM_getReg16(vm, Fy_Reg16_Bx, &y);
+    Fy_VM_getReg16(vm, Fy_Reg16_Cx, &length);
+    Fy_VM_getReg16(vm, Fy_Reg16_Si, &color);
+
+    if (Fy_checkCanDraw(vm, color))
+        Fy_Screen_fillRect(&vm->screen, (int16_t)x, (int16_t)y, length, 1, (uint8_t)color);
+}
+
+/* Draws a line of `cx` pixels downwards */
+static void Fy_interruptVerticalLine_run(Fy_VM *vm) {
+    uint16_t x, y, length, color;
+
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &x);
+    Fy_VM_getReg16(vm, Fy_Reg16_Bx, &y);
+    Fy_VM_getReg16(vm, Fy_Reg16_Cx, &length);
+    Fy_VM_getReg16(vm, Fy_Reg16_Si, &color);
+
+    if (Fy_checkCanDraw(vm, color))
+        Fy_Screen_fillRect(&vm->screen, (int16_t)x, (int16_t)y, 1, length, (uint8_t)color);
+}
+
+/* Fills the whole window with the color in `si` */
+static void Fy_interruptClearScreen_run(Fy_VM *vm) {
+    uint16_t color;
+
+    Fy_VM_getReg16(vm, Fy_Reg16_Si, &color);
+
+    if (Fy_checkCanDraw(vm, color))
+        Fy_Screen_fillRect(&vm->screen, 0, 0, vm->screen.width, vm->screen.height, (uint8_t)color);
+}
+
+/* Draws `cx` by `dx` palette indices stored row after row at `si` */
+static void Fy_interruptBlit_run(Fy_VM *vm) {
+    uint16_t x, y, width, height, address;
+    uint32_t size;
+    uint8_t *colors;
+
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &x);
+    Fy_VM_getReg16(vm, Fy_Reg16_Bx, &y);
+    Fy_VM_getReg16(vm, Fy_Reg16_Cx, &width);
+    Fy_VM_getReg16(vm, Fy_Reg16_Dx, &height);
+    Fy_VM_getReg16(vm, Fy_Reg16_Si, &address);
+
+    if (!Fy_checkCanDraw(vm, 0))
+        return;
+
+    size = (uint32_t)width * height;
+    if (size > (1 << 16)) {
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_InterruptError, "%dx%d image doesn't fit in memory", width, height);
+        return;
+    }
+
+    colors = malloc(size);
+    Fy_VM_readMemInto(vm, address, colors, size);
+    for (uint32_t i = 0; i < size; ++i) {
+        if (!Fy_Screen_isValidColor(colors[i])) {
+            Fy_VM_runtimeError(vm, Fy_RuntimeError_InterruptError, "color '%d' invalid", colors[i]);
+            free(colors);
+            return;
+        }
+    }
+
+    Fy_Screen_blit(&vm->screen, (int16_t)x, (int16_t)y, width, height, colors);
+    free(colors);
+}
+
+/*
+ * Maps a framebuffer with a palette index for every pixel of the window at `ax`.
+ * Plain stores draw to it from then on, and int 5 shows the rows that were written.
+ */
+static void Fy_interruptMapFramebuffer_run(Fy_VM *vm) {
+    uint16_t address;
+
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &address);
+
+    if (!Fy_Screen_isOpen(&vm->screen)) {
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_InterruptError, "no window to map a framebuffer for");
+        return;
+    }
+    if (!Fy_Screen_mapFramebuffer(&vm->screen, vm->mem_space_bottom, address))
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_InterruptError, "framebuffer at %.4X doesn't fit in memory", address);
+}
+
+/*
+ * Like int 3, but the logical size is in `ax` and `bx` and every pixel is shown as `cx` by `cx` pixels of the window.
+ * Lets programs draw at a low resolution without drawing big blocks themselves.
+ */
+static void Fy_interruptOpenScaledWindow_run(Fy_VM *vm) {
+    uint16_t width, height, scale;
+
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &width);
+    Fy_VM_getReg16(vm, Fy_Reg16_Bx, &height);
+    Fy_VM_getReg16(vm, Fy_Reg16_Cx, &scale);
+
+    if (scale == 0 || (uint32_t)width * scale > FY_SCREEN_MAX_WINDOW_SIZE ||
+        (uint32_t)height * scale > FY_SCREEN_MAX_WINDOW_SIZE) {
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_InterruptError, "%dx%d window with a scale of %d is invalid", width,
+                           height, scale);
+        return;
+    }
+
+    Fy_openWindow(vm, (int)width, (int)height, (int)scale);
+}
+
+/*
+ * Loads `cx` tiles stored one after the other at `ax`, starting at tile id `bx`.
+ * Every tile is FY_SCREEN_TILE_SIZE rows of FY_SCREEN_TILE_SIZE palette indices.
+ * Pixels of FY_SCREEN_TRANSPARENT aren't drawn.
+ */
+static void Fy_interruptLoadTiles_run(Fy_VM *vm) {
+    uint8_t pixels[FY_SCREEN_TILE_SIZE * FY_SCREEN_TILE_SIZE];
+    uint16_t address, first, amount;
+
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &address);
+    Fy_VM_getReg16(vm, Fy_Reg16_Bx, &first);
+    Fy_VM_getReg16(vm, Fy_Reg16_Cx, &amount);
+
+    if ((uint32_t)first + amount > FY_SCREEN_TILE_AMOUNT) {
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_InterruptError, "tiles %d to %d don't exist", first, first + amount - 1);
+        return;
+    }
+
+    for (uint16_t i = 0; i < amount; ++i) {
+        Fy_VM_readMemInto(vm, (uint16_t)(address + i * sizeof(pixels)), pixels, sizeof(pixels));
+        if (!Fy_Screen_loadTile(&vm->screen, (uint8_t)(first + i), pixels)) {
+            Fy_VM_runtimeError(vm, Fy_RuntimeError_InterruptError, "tile %d has a color that isn't in the palette",
+                               first + i);
+            return;
+        }
+    }
+}
+
+/*
+ * Composes a frame from the loaded tiles, described by words at `ax`:
+ *  a tilemap address, its width and height in tiles, the signed position of its top left corner,
+ *  a sprite table address and the amount of sprites.
+ * The tilemap holds a tile id for every tile, row after row, and is drawn first.
+ * Every sprite is a signed x and y word, a tile id byte and a byte of FY_SPRITE flags.
+ * Later sprites are drawn on top.
+ */
+static void Fy_interruptDrawScene_run(Fy_VM *vm) {
+    uint16_t address, map_address, map_width, map_height, map_x, map_y, sprites_address, sprite_amount;
+    uint32_t map_size;
+
+    Fy_VM_getReg16(vm, Fy_Reg16_Ax, &address);
+
+    if (!Fy_checkCanDraw(vm, 0))
+        return;
+
+    map_address = Fy_VM_getMem16(vm, address);
+    map_width = Fy_VM_getMem16(vm, address + 2);
+    map_height = Fy_VM_getMem16(vm, address + 4);
+    map_x = Fy_VM_getMem16(vm, address + 6);
+    map_y = Fy_VM_getMem16(vm, address + 8);
+    sprites_address = Fy_VM_getMem16(vm, address + 10);
+    sprite_amount = Fy_VM_getMem16(vm, address + 12);
+
+    map_size = (uint32_t)map_width * map_height;
+    if (map_size > (1 << 16)) {
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_InterruptError, "%dx%d tilemap doesn't fit in memory", map_width,
+                           map_height);
+        return;
+    }
+    if (map_size != 0) {
+        uint8_t *map = malloc(map_size);
+        Fy_VM_readMemInto(vm, map_address, map, map_size);
+        Fy_Screen_drawTilemap(&vm->screen, map, map_width, map_height, (int16_t)map_x, (int16_t)map_y);
+        free(map);
+    }
+
+    for (uint16_t i = 0; i < sprite_amount; ++i) {
+        uint16_t sprite = sprites_address + i * 6;
+        Fy_Screen_drawSprite(&vm->screen, Fy_VM_getMem8(vm, sprite + 4), (int16_t)Fy_VM_getMem16(vm, sprite),
+                             (int16_t)Fy_VM_getMem16(vm, sprite + 2), Fy_VM_getMem8(vm, sprite + 5));
+    }
 }
 
 static void Fy_interruptUpdate_run(Fy_VM *vm) {
-    SDL_UpdateWindowSurface(vm->window);
+    if (Fy_Screen_isOpen(&vm->screen) && !Fy_Screen_update(&vm->screen))
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_InterruptError, "framebuffer has a color that isn't in the palette");
 }
 
 Fy_InterruptRunFunc Fy_findInterruptFuncByOpcode(uint8_t opcode) {
@@ -0,0 +1,202 @@
+#include "fy.h"
+
+bool Fy_OutputFlushPolicy_fromString(char *name, Fy_OutputFlushPolicy *out) {
+    if (strcmp(name, "newline") == 0)
+        *out = Fy_OutputFlushPolicy_Newline;
+    else if (strcmp(name, "size") == 0)
+        *out = Fy_OutputFlushPolicy_Size;
+    else if (strcmp(name, "halt") == 0)
+        *out = Fy_OutputFlushPolicy_Halt;
+    else
+        return false;
+    return true;
+}
+
+static void Fy_Output_writeToStdout(const char *data, size_t length) {
+    fwrite(data, sizeof(char), length, stdout);
+    fflush(stdout);
+}
+
+/* Drains the ring into stdout, writing without holding the lock */
+static void *Fy_Output_writerThread(void *arg) {
+    Fy_Output *output = arg;
+
+    pthread_mutex_lock(&output->lock);
+    for (;;) {
+        size_t amount;
+
+        while (output->ring_length == 0 && !output->stop)
+            pthread_cond_wait(&output->has_data, &output->lock);
+        if (output->ring_length == 0)
+            break;
+
+        // Only write the part until the end of the ring
+        amount = output->ring_length;
+        if (output->ring_start + amount > FY_OUTPUT_RING_SIZE)
+            amount = FY_OUTPUT_RING_SIZE - output->ring_start;
+
+        // The producer never touches used bytes, so they can be read unlocked
+        pthread_mutex_unlock(&output->lock);
+        Fy_Output_writeToStdout(&output->ring[output->ring_start], amount);
+        pthread_mutex_lock(&output->lock);
+
+        output->ring_start = (output->ring_start + amount) % FY_OUTPUT_RING_SIZE;
+        output->ring_length -= amount;
+        pthread_cond_broadcast(&output->has_space);
+    }
+    pthread_mutex_unlock(&output->lock);
+
+    return NULL;
+}
+
+/* Returns whether the operation was successful */
+bool Fy_Output_Init(Fy_Output *out, Fy_OutputFlushPolicy policy, bool threaded) {
+    out->policy = policy;
+    out->buffer = NULL;
+    out->length = 0;
+    out->allocated = 0;
+    out->threaded = threaded;
+
+    if (threaded) {
+        sigset_t block, old;
+        int err;
+
+        out->ring = malloc(FY_OUTPUT_RING_SIZE * sizeof(char));
+        out->ring_start = 0;
+        out->ring_length = 0;
+        out->stop = false;
+        pthread_mutex_init(&out->lock, NULL);
+        pthread_cond_init(&out->has_data, NULL);
+        pthread_cond_init(&out->has_space, NULL);
+
+        // Exit signals should interrupt the virtual machine, not the writer
+        sigemptyset(&block);
+        sigaddset(&block, SIGINT);
+        sigaddset(&block, SIGTERM);
+        pthread_sigmask(SIG_BLOCK, &block, &old);
+        err = pthread_create(&out->thread, NULL, Fy_Output_writerThread, out);
+        pthread_sigmask(SIG_SETMASK, &old, NULL);
+
+        if (err != 0) {
+            pthread_cond_destroy(&out->has_space);
+            pthread_cond_destroy(&out->has_data);
+            pthread_mutex_destroy(&out->lock);
+            free(out->ring);
+            out->threaded = false;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* Flushes everything and waits for the writer thread to finish */
+void Fy_Output_Destruct(Fy_Output *output) {
+    Fy_Output_flush(output);
+    if (output->threaded) {
+        pthread_mutex_lock(&output->lock);
+        output->stop = true;
+        pthread_cond_signal(&output->has_data);
+        pthread_mutex_unlock(&output->lock);
+        pthread_join(output->thread, NULL);
+
+        pthread_cond_destroy(&output->has_space);
+        pthread_cond_destroy(&output->has_data);
+        pthread_mutex_destroy(&output->lock);
+        free(output->ring);
+    }
+    free(output->buffer);
+}
+
+/* Passes the buffered bytes to stdout or to the writer thread */
+void Fy_Output_flush(Fy_Output *output) {
+    size_t written = 0;
+
+    if (output->length == 0)
+        return;
+
+    if (!output->threaded) {
+        Fy_Output_writeToStdout(output->buffer, output->length);
+        output->length = 0;
+        return;
+    }
+
+    pthread_mutex_lock(&output->lock);
+    while (written < output->length) {
+        size_t end, amount;
+
+        // Only blocks if the writer is behind by a whole ring
+        while (output->ring_length == FY_OUTPUT_RING_SIZE)
+            pthread_cond_wait(&output->has_space, &output->lock);
+
+        end = (output->ring_start + output->ring_length) % FY_OUTPUT_RING_SIZE;
+        amount = FY_OUTPUT_RING_SIZE - output->ring_length;
+        if (end + amount > FY_OUTPUT_RING_SIZE)
+            amount = FY_OUTPUT_RING_SIZE - end;
+        if (amount > output->length - written)
+            amount = output->length - written;
+
+        memcpy(&output->ring[end], &output->buffer[written], amount);
+        output->ring_length += amount;
+        written += amount;
+        pthread_cond_signal(&output->has_data);
+    }
+    pthread_mutex_unlock(&output->lock);
+
+    output->length = 0;
+}
+
+/* Flushes and waits until everything reached stdout, so other prints don't interleave */
+void Fy_Output_sync(Fy_Output *output) {
+    Fy_Output_flush(output);
+    if (output->threaded) {
+        pthread_mutex_lock(&output->lock);
+        while (output->ring_length > 0)
+            pthread_cond_wait(&output->has_space, &output->lock);
+        pthread_mutex_unlock(&output->lock);
+    }
+}
+
+void Fy_Output_write(Fy_Output *output, const char *data, size_t length) {
+    if (output->length + length > output->allocated) {
+        size_t allocated = output->allocated ? output->allocated : FY_OUTPUT_FLUSH_SIZE;
+        while (allocated < output->length + length)
+            allocated *= 2;
+        output->buffer = realloc(output->buffer, allocated * sizeof(char));
+        output->allocated = allocated;
+    }
+    memcpy(&output->buffer[output->length], data, length);
+    output->length += length;
+
+    switch (output->policy) {
+    case Fy_OutputFlushPolicy_Newline:
+        if (memchr(data, '\n', length))
+            Fy_Output_flush(output);
+        break;
+    case Fy_OutputFlushPolicy_Size:
+        if (output->length >= FY_OUTPUT_FLUSH_SIZE)
+            Fy_Output_flush(output);
+        break;
+    case Fy_OutputFlushPolicy_Halt:
+        break;
+    default:
+        FY_UNREACHABLE();
+    }
+}
+
+void Fy_Output_writeChar(Fy_Output *output, char c) {
+    Fy_Output_write(output, &c, 1);
+}
+
+void Fy_Output_writeNumber(Fy_Output *output, uint16_t number) {
+    char digits[5];
+    size_t idx = sizeof(digits);
+
+    // Fill digits from the end
+    do {
+        digits[--idx] = '0' + number % 10;
+        number /= 10;
+    } while (number != 0);
+
+    Fy_Output_write(output, &digits[idx], sizeof(digits) - idx);
+}
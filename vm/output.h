@@ -0,0 +1,51 @@
+#ifndef FY_OUTPUT_H
+#define FY_OUTPUT_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <pthread.h>
+
+/* Buffered bytes after which the size policy flushes */
+#define FY_OUTPUT_FLUSH_SIZE 4096
+/* Size of the ring the writer thread drains */
+#define FY_OUTPUT_RING_SIZE (64 * 1024)
+
+typedef enum Fy_OutputFlushPolicy Fy_OutputFlushPolicy;
+typedef struct Fy_Output Fy_Output;
+
+enum Fy_OutputFlushPolicy {
+    /* Flush whenever a newline is written */
+    Fy_OutputFlushPolicy_Newline = 1,
+    /* Flush once FY_OUTPUT_FLUSH_SIZE bytes are buffered */
+    Fy_OutputFlushPolicy_Size,
+    /* Flush only when the program halts or asks for it */
+    Fy_OutputFlushPolicy_Halt
+};
+
+/* Console output of a virtual machine */
+struct Fy_Output {
+    Fy_OutputFlushPolicy policy;
+    char *buffer;
+    size_t length, allocated;
+
+    /* Writer thread that writes the flushed bytes to stdout */
+    bool threaded;
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t has_data, has_space;
+    char *ring;
+    size_t ring_start, ring_length;
+    bool stop;
+};
+
+bool Fy_OutputFlushPolicy_fromString(char *name, Fy_OutputFlushPolicy *out);
+bool Fy_Output_Init(Fy_Output *out, Fy_OutputFlushPolicy policy, bool threaded);
+void Fy_Output_Destruct(Fy_Output *output);
+void Fy_Output_write(Fy_Output *output, const char *data, size_t length);
+void Fy_Output_writeChar(Fy_Output *output, char c);
+void Fy_Output_writeNumber(Fy_Output *output, uint16_t number);
+void Fy_Output_flush(Fy_Output *output);
+void Fy_Output_sync(Fy_Output *output);
+
+#endif /* FY_OUTPUT_H */
@@ -0,0 +1,153 @@
+#include "fy.h"
+
+/* Like the vector kernels, the SIMD kernels are compiled for their own targets and picked at runtime */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FY_PALETTE_X86
+#include <immintrin.h>
+#define FY_PALETTE_SSSE3_TARGET __attribute__((target("ssse3")))
+#define FY_PALETTE_AVX2_TARGET __attribute__((target("avx2")))
+#endif
+
+static bool Fy_Palette_detected = false;
+static bool Fy_Palette_has_ssse3 = false;
+static bool Fy_Palette_has_avx2 = false;
+
+/* Stores a mapped color in a pixel of `bytes_per_pixel` bytes */
+static inline void Fy_Palette_storePixel(uint8_t *pixel, int bytes_per_pixel, uint32_t value) {
+    switch (bytes_per_pixel) {
+    case 1:
+        *pixel = (uint8_t)value;
+        break;
+    case 2:
+        *(uint16_t*)pixel = (uint16_t)value;
+        break;
+    case 3:
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+        pixel[0] = (value >> 16) & 0xff;
+        pixel[1] = (value >> 8) & 0xff;
+        pixel[2] = value & 0xff;
+#else
+        pixel[0] = value & 0xff;
+        pixel[1] = (value >> 8) & 0xff;
+        pixel[2] = (value >> 16) & 0xff;
+#endif
+        break;
+    case 4:
+        *(uint32_t*)pixel = value;
+        break;
+    default:
+        FY_UNREACHABLE();
+    }
+}
+
+static void Fy_Palette_expandScalar(const uint32_t *palette, const uint8_t *indices, uint8_t *out, size_t count,
+                                    int bytes_per_pixel) {
+    for (size_t i = 0; i < count; ++i) {
+        Fy_Palette_storePixel(out, bytes_per_pixel, palette[indices[i]]);
+        out += bytes_per_pixel;
+    }
+}
+
+#ifdef FY_PALETTE_X86
+
+/* Builds a table of byte `byte` of every color, so pshufb can look 16 indices up at once */
+FY_PALETTE_SSSE3_TARGET
+static __m128i Fy_Palette_getBytePlane(const uint32_t *palette, size_t palette_size, int byte) {
+    uint8_t plane[16] = { 0 };
+    for (size_t i = 0; i < palette_size; ++i)
+        plane[i] = (palette[i] >> (byte * 8)) & 0xff;
+    return _mm_loadu_si128((const __m128i*)plane);
+}
+
+/* Handles palettes of up to 16 colors and 1, 2 or 4 byte pixels, returns how many pixels it expanded */
+FY_PALETTE_SSSE3_TARGET
+static size_t Fy_Palette_expandSsse3(const uint32_t *palette, size_t palette_size, const uint8_t *indices, uint8_t *out,
+                                     size_t count, int bytes_per_pixel) {
+    __m128i planes[4];
+    size_t i;
+
+    for (int byte = 0; byte < bytes_per_pixel; ++byte)
+        planes[byte] = Fy_Palette_getBytePlane(palette, palette_size, byte);
+
+    for (i = 0; i + 16 <= count; i += 16) {
+        __m128i index = _mm_loadu_si128((const __m128i*)(indices + i));
+        __m128i byte0 = _mm_shuffle_epi8(planes[0], index);
+        uint8_t *at = out + i * bytes_per_pixel;
+
+        if (bytes_per_pixel == 1) {
+            _mm_storeu_si128((__m128i*)at, byte0);
+        } else {
+            // Interleave the planes back into whole pixels, the lowest byte first
+            __m128i byte1 = _mm_shuffle_epi8(planes[1], index);
+            __m128i low01 = _mm_unpacklo_epi8(byte0, byte1);
+            __m128i high01 = _mm_unpackhi_epi8(byte0, byte1);
+
+            if (bytes_per_pixel == 2) {
+                _mm_storeu_si128((__m128i*)at, low01);
+                _mm_storeu_si128((__m128i*)(at + 16), high01);
+            } else {
+                __m128i byte2 = _mm_shuffle_epi8(planes[2], index);
+                __m128i byte3 = _mm_shuffle_epi8(planes[3], index);
+                __m128i low23 = _mm_unpacklo_epi8(byte2, byte3);
+                __m128i high23 = _mm_unpackhi_epi8(byte2, byte3);
+
+                _mm_storeu_si128((__m128i*)at, _mm_unpacklo_epi16(low01, low23));
+                _mm_storeu_si128((__m128i*)(at + 16), _mm_unpackhi_epi16(low01, low23));
+                _mm_storeu_si128((__m128i*)(at + 32), _mm_unpacklo_epi16(high01, high23));
+                _mm_storeu_si128((__m128i*)(at + 48), _mm_unpackhi_epi16(high01, high23));
+            }
+        }
+    }
+    return i;
+}
+
+/* Handles palettes of up to 8 colors and 4 byte pixels, returns how many pixels it expanded */
+FY_PALETTE_AVX2_TARGET
+static size_t Fy_Palette_expandAvx2(const uint32_t *palette, size_t palette_size, const uint8_t *indices, uint8_t *out,
+                                    size_t count) {
+    uint32_t padded[8] = { 0 };
+    __m256i table;
+    size_t i;
+
+    memcpy(padded, palette, palette_size * sizeof(uint32_t));
+    table = _mm256_loadu_si256((const __m256i*)padded);
+
+    for (i = 0; i + 8 <= count; i += 8) {
+        __m256i index = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(indices + i)));
+        _mm256_storeu_si256((__m256i*)(out + i * 4), _mm256_permutevar8x32_epi32(table, index));
+    }
+    return i;
+}
+
+#endif /* FY_PALETTE_X86 */
+
+static void Fy_Palette_detect(void) {
+#ifdef FY_PALETTE_X86
+    __builtin_cpu_init();
+    Fy_Palette_has_ssse3 = __builtin_cpu_supports("ssse3");
+    Fy_Palette_has_avx2 = __builtin_cpu_supports("avx2");
+#endif
+    Fy_Palette_detected = true;
+}
+
+/*
+ * Writes the colors of `count` palette indices to `out` as pixels of `bytes_per_pixel` bytes.
+ * `palette` holds colors already mapped to the pixel format, and every index must be below `palette_size`.
+ */
+void Fy_Palette_expand(const uint32_t *palette, size_t palette_size, const uint8_t *indices, uint8_t *out, size_t count,
+                       int bytes_per_pixel) {
+    size_t done = 0;
+
+    if (!Fy_Palette_detected)
+        Fy_Palette_detect();
+
+#ifdef FY_PALETTE_X86
+    if (Fy_Palette_has_avx2 && bytes_per_pixel == 4 && palette_size <= 8)
+        done = Fy_Palette_expandAvx2(palette, palette_size, indices, out, count);
+    else if (Fy_Palette_has_ssse3 && bytes_per_pixel != 3 && palette_size <= 16)
+        done = Fy_Palette_expandSsse3(palette, palette_size, indices, out, count, bytes_per_pixel);
+#endif
+
+    // The tail that doesn't fill a whole block, and formats the kernels don't handle
+    Fy_Palette_expandScalar(palette, indices + done, out + done * bytes_per_pixel, count - done, bytes_per_pixel);
+}
@@ -0,0 +1,11 @@
+#ifndef FY_PALETTE_H
+#define FY_PALETTE_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+void Fy_Palette_expand(const uint32_t *palette, size_t palette_size, const uint8_t *indices, uint8_t *out, size_t count,
+                       int bytes_per_pixel);
+
+#endif /* FY_PALETTE_H */
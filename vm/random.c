@@ -0,0 +1,54 @@
+#include "fy.h"
+
+/* Advances a splitmix64 state, used to spread the seed over the whole generator state */
+static uint64_t Fy_splitmix64(uint64_t *state) {
+    uint64_t z = (*state += 0x9e3779b97f4a7c15);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    return z ^ (z >> 31);
+}
+
+static inline uint32_t Fy_rotl32(uint32_t x, int k) {
+    return (x << k) | (x >> (32 - k));
+}
+
+void Fy_Random_Init(Fy_Random *out, uint64_t seed) {
+    uint64_t mixer = seed;
+    uint64_t low = Fy_splitmix64(&mixer);
+    uint64_t high = Fy_splitmix64(&mixer);
+
+    out->state[0] = (uint32_t)low;
+    out->state[1] = (uint32_t)(low >> 32);
+    out->state[2] = (uint32_t)high;
+    out->state[3] = (uint32_t)(high >> 32);
+    // xoshiro is stuck at zero if the whole state is zero
+    if ((out->state[0] | out->state[1] | out->state[2] | out->state[3]) == 0)
+        out->state[0] = 1;
+}
+
+/* Returns a seed that changes between runs */
+uint64_t Fy_Random_getTimeSeed(void) {
+    struct timespec tm;
+    clock_gettime(CLOCK_REALTIME, &tm);
+    return ((uint64_t)tm.tv_sec << 32) ^ (uint64_t)tm.tv_nsec ^ ((uint64_t)getpid() << 16);
+}
+
+uint32_t Fy_Random_next32(Fy_Random *random) {
+    uint32_t *s = random->state;
+    uint32_t result = Fy_rotl32(s[1] * 5, 7) * 9;
+    uint32_t t = s[1] << 9;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = Fy_rotl32(s[3], 11);
+
+    return result;
+}
+
+/* The upper bits of xoshiro128** are the strongest */
+uint16_t Fy_Random_next16(Fy_Random *random) {
+    return (uint16_t)(Fy_Random_next32(random) >> 16);
+}
@@ -0,0 +1,18 @@
+#ifndef FY_RANDOM_H
+#define FY_RANDOM_H
+
+#include <inttypes.h>
+
+typedef struct Fy_Random Fy_Random;
+
+/* xoshiro128** generator state, never all zeros */
+struct Fy_Random {
+    uint32_t state[4];
+};
+
+void Fy_Random_Init(Fy_Random *out, uint64_t seed);
+uint64_t Fy_Random_getTimeSeed(void);
+uint32_t Fy_Random_next32(Fy_Random *random);
+uint16_t Fy_Random_next16(Fy_Random *random);
+
+#endif /* FY_RANDOM_H */
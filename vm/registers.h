@@ -3,6 +3,7 @@
 
 typedef enum Fy_Reg16 Fy_Reg16;
 typedef enum Fy_Reg8 Fy_Reg8;
+typedef enum Fy_RegFloat Fy_RegFloat;
 
 enum Fy_Reg16 {
     Fy_Reg16_Ax,
@@ -10,7 +11,17 @@ enum Fy_Reg16 {
     Fy_Reg16_Cx,
     Fy_Reg16_Dx,
     Fy_Reg16_Sp,
-    Fy_Reg16_Bp
+    Fy_Reg16_Bp,
+    Fy_Reg16_Si,
+    Fy_Reg16_Di,
+    Fy_Reg16_R8,
+    Fy_Reg16_R9,
+    Fy_Reg16_R10,
+    Fy_Reg16_R11,
+    Fy_Reg16_R12,
+    Fy_Reg16_R13,
+    Fy_Reg16_R14,
+    Fy_Reg16_R15
 };
 
 enum Fy_Reg8 {
@@ -24,4 +35,15 @@ enum Fy_Reg8 {
     Fy_Reg8_Dl
 };
 
+enum Fy_RegFloat {
+    Fy_RegFloat_F0,
+    Fy_RegFloat_F1,
+    Fy_RegFloat_F2,
+    Fy_RegFloat_F3,
+    Fy_RegFloat_F4,
+    Fy_RegFloat_F5,
+    Fy_RegFloat_F6,
+    Fy_RegFloat_F7
+};
+
 #endif /* FY_DEFINES_H */
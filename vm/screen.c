@@ -0,0 +1,498 @@
+#include "fy.h"
+
+SDL_Color Fy_screenPalette[FY_SCREEN_PALETTE_SIZE] = {
+    { 0xff, 0xff, 0xff, 0xff },
+    { 0, 0, 0, 0xff },
+    { 0xff, 0, 0, 0xff },
+    { 0, 0xff, 0, 0xff },
+    { 0, 0, 0xff, 0xff }
+};
+
+void Fy_Screen_Init(Fy_Screen *out, Fy_ScreenOptions *options) {
+    out->options = *options;
+    out->frame_number = 0;
+    out->capturing = false;
+    if (options->capture_path) {
+        out->capturing = Fy_Capture_Init(&out->capture, options->capture_path);
+        if (!out->capturing)
+            fprintf(stderr, "Couldn't start capturing to '%s', not capturing frames\n", options->capture_path);
+    }
+    out->window = NULL;
+    out->surface = NULL;
+    out->renderer = NULL;
+    out->texture = NULL;
+    out->pixels = NULL;
+    out->framebuffer = NULL;
+    out->dirty_rows = NULL;
+    out->dirty_rect_amount = 0;
+    out->all_dirty = false;
+    memset(out->tiles, FY_SCREEN_TRANSPARENT, sizeof(out->tiles));
+    memset(out->tile_opaque, 0, sizeof(out->tile_opaque));
+}
+
+void Fy_Screen_Destruct(Fy_Screen *screen) {
+    if (screen->texture)
+        SDL_DestroyTexture(screen->texture);
+    if (screen->renderer)
+        SDL_DestroyRenderer(screen->renderer);
+    // The window surface belongs to the window, so it isn't freed here
+    if (screen->window) {
+        SDL_DestroyWindow(screen->window);
+        SDL_Quit();
+    }
+    if (screen->capturing)
+        Fy_Capture_Destruct(&screen->capture);
+    free(screen->pixels);
+    free(screen->dirty_rows);
+}
+
+static void Fy_Screen_mapPalette(Fy_Screen *screen, const SDL_PixelFormat *format) {
+    for (size_t i = 0; i < FY_SCREEN_PALETTE_SIZE; ++i) {
+        SDL_Color color = Fy_screenPalette[i];
+        screen->palette[i] = SDL_MapRGBA(format, color.r, color.g, color.b, color.a);
+    }
+}
+
+/* Creates a texture of the logical size that the renderer stretches over the window with nearest-neighbour */
+static bool Fy_Screen_createRenderer(Fy_Screen *screen, int width, int height) {
+    SDL_PixelFormat *format;
+
+    SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "nearest");
+    screen->renderer = SDL_CreateRenderer(screen->window, -1, 0);
+    if (!screen->renderer)
+        return false;
+
+    screen->texture = SDL_CreateTexture(screen->renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, width,
+                                        height);
+    if (!screen->texture)
+        return false;
+
+    format = SDL_AllocFormat(SDL_PIXELFORMAT_ARGB8888);
+    if (!format)
+        return false;
+    Fy_Screen_mapPalette(screen, format);
+    SDL_FreeFormat(format);
+    return true;
+}
+
+static bool Fy_Screen_openWindow(Fy_Screen *screen, int width, int height, int scale) {
+    bool success;
+
+    SDL_Init(SDL_INIT_VIDEO);
+    screen->window = SDL_CreateWindow("Fytecode window", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, width * scale,
+                                      height * scale, SDL_WINDOW_SHOWN);
+    if (!screen->window)
+        return false;
+
+    if (scale == 1) {
+        screen->surface = SDL_GetWindowSurface(screen->window);
+        success = screen->surface != NULL;
+        if (success)
+            Fy_Screen_mapPalette(screen, screen->surface->format);
+    } else {
+        success = Fy_Screen_createRenderer(screen, width, height);
+    }
+
+    if (!success) {
+        if (screen->texture)
+            SDL_DestroyTexture(screen->texture);
+        if (screen->renderer)
+            SDL_DestroyRenderer(screen->renderer);
+        SDL_DestroyWindow(screen->window);
+        screen->texture = NULL;
+        screen->renderer = NULL;
+        screen->surface = NULL;
+        screen->window = NULL;
+    }
+    return success;
+}
+
+/* Creates the backbuffer and, unless headless, the window showing it `scale` times bigger */
+bool Fy_Screen_open(Fy_Screen *screen, int width, int height, int scale) {
+    size_t size = (size_t)width * height;
+
+    if (!screen->options.headless && !Fy_Screen_openWindow(screen, width, height, scale))
+        return false;
+
+    screen->width = width;
+    screen->height = height;
+    screen->scale = scale;
+    screen->pixels = malloc(size ? size : 1);
+    // A new window starts out black
+    memset(screen->pixels, 1, size);
+    Fy_Screen_markAllDirty(screen);
+    return true;
+}
+
+bool Fy_Screen_isOpen(Fy_Screen *screen) {
+    return screen->pixels != NULL;
+}
+
+/* Whether there is a real window, which also means there are SDL events */
+bool Fy_Screen_hasWindow(Fy_Screen *screen) {
+    return screen->window != NULL;
+}
+
+bool Fy_Screen_isValidColor(uint16_t color) {
+    return color < FY_SCREEN_PALETTE_SIZE;
+}
+
+bool Fy_Screen_containsPixel(Fy_Screen *screen, int x, int y) {
+    return x >= 0 && y >= 0 && x < screen->width && y < screen->height;
+}
+
+/* Makes the next update present the whole surface */
+void Fy_Screen_markAllDirty(Fy_Screen *screen) {
+    screen->all_dirty = true;
+    screen->dirty_rect_amount = 0;
+}
+
+static int Fy_Screen_getArea(const SDL_Rect *rect) {
+    return rect->w * rect->h;
+}
+
+static SDL_Rect Fy_Screen_getBoundingRect(const SDL_Rect *rect1, const SDL_Rect *rect2) {
+    SDL_Rect bounds;
+    int right = rect1->x + rect1->w > rect2->x + rect2->w ? rect1->x + rect1->w : rect2->x + rect2->w;
+    int bottom = rect1->y + rect1->h > rect2->y + rect2->h ? rect1->y + rect1->h : rect2->y + rect2->h;
+
+    bounds.x = rect1->x < rect2->x ? rect1->x : rect2->x;
+    bounds.y = rect1->y < rect2->y ? rect1->y : rect2->y;
+    bounds.w = right - bounds.x;
+    bounds.h = bottom - bounds.y;
+    return bounds;
+}
+
+/*
+ * Adds a clipped rectangle to the ones the next update presents.
+ * Rectangles are merged when their bounding rectangle isn't bigger than both of them, like neighbouring pixels.
+ */
+static void Fy_Screen_addDirtyRect(Fy_Screen *screen, SDL_Rect rect) {
+    size_t i = 0;
+
+    if (screen->all_dirty)
+        return;
+
+    // A merged rectangle can touch ones that were checked before it, so start over after every merge
+    while (i < screen->dirty_rect_amount) {
+        SDL_Rect *other = &screen->dirty_rects[i];
+        SDL_Rect bounds = Fy_Screen_getBoundingRect(&rect, other);
+
+        if (Fy_Screen_getArea(&bounds) <= Fy_Screen_getArea(&rect) + Fy_Screen_getArea(other)) {
+            rect = bounds;
+            *other = screen->dirty_rects[--screen->dirty_rect_amount];
+            i = 0;
+        } else {
+            ++i;
+        }
+    }
+
+    if (screen->dirty_rect_amount == FY_SCREEN_MAX_DIRTY_RECTS)
+        Fy_Screen_markAllDirty(screen);
+    else
+        screen->dirty_rects[screen->dirty_rect_amount++] = rect;
+}
+
+/* Cuts the rectangle to the part inside the screen, returns false if nothing is left */
+static bool Fy_Screen_clip(Fy_Screen *screen, SDL_Rect *rect) {
+    int right = rect->x + rect->w, bottom = rect->y + rect->h;
+
+    if (rect->x < 0)
+        rect->x = 0;
+    if (rect->y < 0)
+        rect->y = 0;
+    if (right > screen->width)
+        right = screen->width;
+    if (bottom > screen->height)
+        bottom = screen->height;
+
+    rect->w = right - rect->x;
+    rect->h = bottom - rect->y;
+    return rect->w > 0 && rect->h > 0;
+}
+
+/* Expects the pixel to be in the screen and the color to be valid */
+void Fy_Screen_setPixel(Fy_Screen *screen, int x, int y, uint8_t color) {
+    screen->pixels[y * screen->width + x] = color;
+    Fy_Screen_addDirtyRect(screen, (SDL_Rect){ x, y, 1, 1 });
+}
+
+/* Fills the part of the rectangle that is inside the screen, expects the color to be valid */
+void Fy_Screen_fillRect(Fy_Screen *screen, int x, int y, int width, int height, uint8_t color) {
+    SDL_Rect rect = { x, y, width, height };
+
+    if (!Fy_Screen_clip(screen, &rect))
+        return;
+
+    for (int row = rect.y; row < rect.y + rect.h; ++row)
+        memset(&screen->pixels[row * screen->width + rect.x], color, rect.w);
+    Fy_Screen_addDirtyRect(screen, rect);
+}
+
+/*
+ * Draws `width` * `height` palette indices, stored row after row, with the top left corner at (x, y).
+ * Only the part inside the screen is drawn. Expects all of the colors to be valid.
+ */
+void Fy_Screen_blit(Fy_Screen *screen, int x, int y, int width, int height, const uint8_t *colors) {
+    SDL_Rect rect = { x, y, width, height };
+
+    if (!Fy_Screen_clip(screen, &rect))
+        return;
+
+    for (int row = 0; row < rect.h; ++row) {
+        const uint8_t *source = colors + (size_t)(rect.y - y + row) * width + (rect.x - x);
+        memcpy(&screen->pixels[(rect.y + row) * screen->width + rect.x], source, rect.w);
+    }
+    Fy_Screen_addDirtyRect(screen, rect);
+}
+
+/* Replaces a tile, returns false if one of its pixels is neither in the palette nor transparent */
+bool Fy_Screen_loadTile(Fy_Screen *screen, uint8_t id, const uint8_t *pixels) {
+    bool opaque = true;
+
+    for (size_t i = 0; i < FY_SCREEN_TILE_SIZE * FY_SCREEN_TILE_SIZE; ++i) {
+        if (pixels[i] == FY_SCREEN_TRANSPARENT)
+            opaque = false;
+        else if (!Fy_Screen_isValidColor(pixels[i]))
+            return false;
+    }
+
+    memcpy(screen->tiles[id], pixels, FY_SCREEN_TILE_SIZE * FY_SCREEN_TILE_SIZE);
+    screen->tile_opaque[id] = opaque;
+    return true;
+}
+
+/* Draws the part of a tile inside the screen with its top left corner at (x, y), without marking it as dirty */
+static void Fy_Screen_drawTile(Fy_Screen *screen, uint8_t id, int x, int y, uint8_t flags) {
+    const uint8_t *tile = screen->tiles[id];
+    SDL_Rect rect = { x, y, FY_SCREEN_TILE_SIZE, FY_SCREEN_TILE_SIZE };
+
+    if (!Fy_Screen_clip(screen, &rect))
+        return;
+
+    // Most background tiles are opaque and unflipped, so whole rows can be copied
+    if (screen->tile_opaque[id] && flags == 0) {
+        for (int row = rect.y; row < rect.y + rect.h; ++row) {
+            memcpy(&screen->pixels[row * screen->width + rect.x],
+                   &tile[(row - y) * FY_SCREEN_TILE_SIZE + (rect.x - x)], rect.w);
+        }
+        return;
+    }
+
+    for (int row = rect.y; row < rect.y + rect.h; ++row) {
+        int tile_row = flags & FY_SPRITE_FLIP_Y ? FY_SCREEN_TILE_SIZE - 1 - (row - y) : row - y;
+        for (int column = rect.x; column < rect.x + rect.w; ++column) {
+            int tile_column = flags & FY_SPRITE_FLIP_X ? FY_SCREEN_TILE_SIZE - 1 - (column - x) : column - x;
+            uint8_t color = tile[tile_row * FY_SCREEN_TILE_SIZE + tile_column];
+            if (color != FY_SCREEN_TRANSPARENT)
+                screen->pixels[row * screen->width + column] = color;
+        }
+    }
+}
+
+/*
+ * Draws a map of `map_width` by `map_height` tile ids, stored row after row, with its top left corner at (x, y).
+ * Only the tiles that are at least partly inside the screen are looked at.
+ */
+void Fy_Screen_drawTilemap(Fy_Screen *screen, const uint8_t *map, int map_width, int map_height, int x, int y) {
+    SDL_Rect rect = { x, y, map_width * FY_SCREEN_TILE_SIZE, map_height * FY_SCREEN_TILE_SIZE };
+    int first_column, last_column, first_row, last_row;
+
+    if (!Fy_Screen_clip(screen, &rect))
+        return;
+
+    // The clipped rectangle starts and ends inside the map, so these are valid tile indices
+    first_column = (rect.x - x) / FY_SCREEN_TILE_SIZE;
+    last_column = (rect.x + rect.w - 1 - x) / FY_SCREEN_TILE_SIZE;
+    first_row = (rect.y - y) / FY_SCREEN_TILE_SIZE;
+    last_row = (rect.y + rect.h - 1 - y) / FY_SCREEN_TILE_SIZE;
+
+    for (int row = first_row; row <= last_row; ++row) {
+        for (int column = first_column; column <= last_column; ++column) {
+            Fy_Screen_drawTile(screen, map[row * map_width + column], x + column * FY_SCREEN_TILE_SIZE,
+                               y + row * FY_SCREEN_TILE_SIZE, 0);
+        }
+    }
+    Fy_Screen_addDirtyRect(screen, rect);
+}
+
+/* Draws a tile with its top left corner at (x, y), `flags` holds the FY_SPRITE flags */
+void Fy_Screen_drawSprite(Fy_Screen *screen, uint8_t tile, int x, int y, uint8_t flags) {
+    SDL_Rect rect = { x, y, FY_SCREEN_TILE_SIZE, FY_SCREEN_TILE_SIZE };
+
+    if (!Fy_Screen_clip(screen, &rect))
+        return;
+
+    Fy_Screen_drawTile(screen, tile, x, y, flags);
+    Fy_Screen_addDirtyRect(screen, rect);
+}
+
+static uint32_t Fy_Screen_getFramebufferSize(Fy_Screen *screen) {
+    return (uint32_t)screen->width * (uint32_t)screen->height;
+}
+
+/*
+ * Shows the window-sized framebuffer at `address` in `memory` on every update from now on.
+ * Returns false if it doesn't fit before the end of memory.
+ */
+bool Fy_Screen_mapFramebuffer(Fy_Screen *screen, const uint8_t *memory, uint16_t address) {
+    size_t bitmap_size = (screen->height + 7) / 8;
+
+    if ((uint32_t)address + Fy_Screen_getFramebufferSize(screen) > (1 << 16))
+        return false;
+
+    screen->framebuffer = &memory[address];
+    screen->framebuffer_address = address;
+    free(screen->dirty_rows);
+    // Whatever is in memory already should be shown on the next update
+    screen->dirty_rows = malloc(bitmap_size ? bitmap_size : 1);
+    memset(screen->dirty_rows, 0xff, bitmap_size);
+    return true;
+}
+
+/* Marks the framebuffer rows that `length` bytes written at `address` touch, the range mustn't wrap around memory */
+void Fy_Screen_markWritten(Fy_Screen *screen, uint16_t address, uint32_t length) {
+    uint32_t start = address, end = (uint32_t)address + length;
+    uint32_t framebuffer_start = screen->framebuffer_address;
+    uint32_t framebuffer_end = framebuffer_start + Fy_Screen_getFramebufferSize(screen);
+    uint32_t first_row, last_row;
+
+    if (!screen->framebuffer || length == 0 || end <= framebuffer_start || start >= framebuffer_end)
+        return;
+
+    if (start < framebuffer_start)
+        start = framebuffer_start;
+    if (end > framebuffer_end)
+        end = framebuffer_end;
+
+    first_row = (start - framebuffer_start) / screen->width;
+    last_row = (end - 1 - framebuffer_start) / screen->width;
+    for (uint32_t row = first_row; row <= last_row; ++row)
+        screen->dirty_rows[row / 8] |= 1 << (row % 8);
+}
+
+/* Copies the dirty framebuffer rows to the backbuffer, returns false if one of them has a color that isn't in the palette */
+static bool Fy_Screen_copyDirtyRows(Fy_Screen *screen) {
+    // Start of the run of dirty rows we are in, or -1
+    int run_start = -1;
+    bool valid = true;
+
+    for (int row = 0; row <= screen->height && valid; ++row) {
+        const uint8_t *source;
+
+        if (row == screen->height || !(screen->dirty_rows[row / 8] & (1 << (row % 8)))) {
+            // Consecutive rows are presented as one rectangle
+            if (run_start != -1)
+                Fy_Screen_addDirtyRect(screen, (SDL_Rect){ 0, run_start, screen->width, row - run_start });
+            run_start = -1;
+            continue;
+        }
+
+        source = &screen->framebuffer[row * screen->width];
+        for (int column = 0; column < screen->width; ++column) {
+            if (!Fy_Screen_isValidColor(source[column]))
+                valid = false;
+        }
+        memcpy(&screen->pixels[row * screen->width], source, screen->width);
+        if (run_start == -1)
+            run_start = row;
+    }
+
+    memset(screen->dirty_rows, 0, (screen->height + 7) / 8);
+    return valid;
+}
+
+/* Converts a rectangle of the backbuffer to pixels of `bytes_per_pixel` bytes, `out` points at its top left corner */
+static void Fy_Screen_expandRect(Fy_Screen *screen, const SDL_Rect *rect, uint8_t *out, int pitch, int bytes_per_pixel) {
+    for (int row = 0; row < rect->h; ++row) {
+        const uint8_t *indices = &screen->pixels[(rect->y + row) * screen->width + rect->x];
+        Fy_Palette_expand(screen->palette, FY_SCREEN_PALETTE_SIZE, indices, out + pitch * row, rect->w, bytes_per_pixel);
+    }
+}
+
+static void Fy_Screen_expandToSurface(Fy_Screen *screen, const SDL_Rect *rect) {
+    SDL_Surface *surface = screen->surface;
+    int bytes_per_pixel = surface->format->BytesPerPixel;
+
+    Fy_Screen_expandRect(screen, rect, (uint8_t*)surface->pixels + surface->pitch * rect->y + rect->x * bytes_per_pixel,
+                         surface->pitch, bytes_per_pixel);
+}
+
+static void Fy_Screen_expandToTexture(Fy_Screen *screen, const SDL_Rect *rect) {
+    void *pixels;
+    int pitch;
+
+    // Only the locked rectangle is uploaded
+    if (SDL_LockTexture(screen->texture, rect, &pixels, &pitch) != 0)
+        return;
+    Fy_Screen_expandRect(screen, rect, pixels, pitch, 4);
+    SDL_UnlockTexture(screen->texture);
+}
+
+/* Shows the dirty parts of the backbuffer in the window */
+static void Fy_Screen_present(Fy_Screen *screen) {
+    SDL_Rect whole = { 0, 0, screen->width, screen->height };
+    int dirty_area = 0;
+    bool full_update;
+
+    if (!screen->all_dirty && screen->dirty_rect_amount == 0)
+        return;
+
+    for (size_t i = 0; i < screen->dirty_rect_amount; ++i)
+        dirty_area += Fy_Screen_getArea(&screen->dirty_rects[i]);
+    // Past some point presenting rectangles one by one costs more than the whole surface
+    full_update = screen->all_dirty || dirty_area * 100 > screen->width * screen->height * FY_SCREEN_FULL_UPDATE_PERCENT;
+
+    if (screen->renderer) {
+        if (full_update) {
+            Fy_Screen_expandToTexture(screen, &whole);
+        } else {
+            for (size_t i = 0; i < screen->dirty_rect_amount; ++i)
+                Fy_Screen_expandToTexture(screen, &screen->dirty_rects[i]);
+        }
+        // The renderer always presents whole frames
+        SDL_RenderCopy(screen->renderer, screen->texture, NULL, NULL);
+        SDL_RenderPresent(screen->renderer);
+        return;
+    }
+
+    SDL_LockSurface(screen->surface);
+    if (full_update) {
+        Fy_Screen_expandToSurface(screen, &whole);
+    } else {
+        for (size_t i = 0; i < screen->dirty_rect_amount; ++i)
+            Fy_Screen_expandToSurface(screen, &screen->dirty_rects[i]);
+    }
+    SDL_UnlockSurface(screen->surface);
+
+    if (full_update)
+        SDL_UpdateWindowSurface(screen->window);
+    else
+        SDL_UpdateWindowSurfaceRects(screen->window, screen->dirty_rects, (int)screen->dirty_rect_amount);
+}
+
+/*
+ * Presents what was drawn since the last update, and dumps and captures the frame if asked to.
+ * Returns false if the framebuffer has a color that isn't in the palette.
+ */
+bool Fy_Screen_update(Fy_Screen *screen) {
+    if (screen->framebuffer && !Fy_Screen_copyDirtyRows(screen))
+        return false;
+
+    if (screen->window)
+        Fy_Screen_present(screen);
+    screen->dirty_rect_amount = 0;
+    screen->all_dirty = false;
+
+    if (screen->options.dump_prefix) {
+        if (!Fy_FrameDump_write(screen->options.dump_prefix, screen->options.dump_format, screen->frame_number,
+                                screen->pixels, screen->width, screen->height)) {
+            fprintf(stderr, "Couldn't write frame %" PRIu32 ", not dumping more frames\n", screen->frame_number);
+            screen->options.dump_prefix = NULL;
+        }
+    }
+    if (screen->capturing)
+        Fy_Capture_addFrame(&screen->capture, screen->pixels, screen->width, screen->height);
+    ++screen->frame_number;
+    return true;
+}
@@ -0,0 +1,95 @@
+#ifndef FY_SCREEN_H
+#define FY_SCREEN_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <SDL2/SDL.h>
+
+#include "framedump.h"
+#include "capture.h"
+
+#define FY_SCREEN_PALETTE_SIZE 5
+/* Changed rectangles kept before an update presents the whole surface */
+#define FY_SCREEN_MAX_DIRTY_RECTS 16
+/* Percentage of the surface that may change before an update presents all of it */
+#define FY_SCREEN_FULL_UPDATE_PERCENT 50
+/* Biggest width or height of a window, after scaling */
+#define FY_SCREEN_MAX_WINDOW_SIZE 4096
+/* Tiles are FY_SCREEN_TILE_SIZE by FY_SCREEN_TILE_SIZE palette indices */
+#define FY_SCREEN_TILE_SIZE 8
+#define FY_SCREEN_TILE_AMOUNT 256
+/* Tile pixels of this color aren't drawn */
+#define FY_SCREEN_TRANSPARENT 0xff
+/* Sprite flags */
+#define FY_SPRITE_FLIP_X (1 << 0)
+#define FY_SPRITE_FLIP_Y (1 << 1)
+
+typedef struct Fy_ScreenOptions Fy_ScreenOptions;
+typedef struct Fy_Screen Fy_Screen;
+
+struct Fy_ScreenOptions {
+    /* Draw only to the backbuffer, without opening a window */
+    bool headless;
+    /* Write every presented frame to files starting with this, NULL if frames aren't dumped */
+    char *dump_prefix;
+    Fy_FrameFormat dump_format;
+    /* Stream every presented frame to this file, NULL if frames aren't captured */
+    char *capture_path;
+};
+
+/* The window a program draws on, opened by int 3 */
+struct Fy_Screen {
+    Fy_ScreenOptions options;
+    uint32_t frame_number;
+    bool capturing;
+    Fy_Capture capture;
+    /* NULL when headless */
+    SDL_Window *window;
+    /* Unscaled windows are drawn through their surface, scaled ones through a renderer */
+    SDL_Surface *surface;
+    SDL_Renderer *renderer;
+    SDL_Texture *texture;
+    /* Logical size, every pixel is `scale` by `scale` pixels of the window */
+    int width, height, scale;
+    /* Backbuffer that drawing goes to, a palette index for every pixel, row after row */
+    uint8_t *pixels;
+    /* Fy_screenPalette in the pixel format of the surface or texture */
+    uint32_t palette[FY_SCREEN_PALETTE_SIZE];
+    /* Guest memory holding a palette index for every pixel, NULL until int 47 maps it */
+    const uint8_t *framebuffer;
+    uint16_t framebuffer_address;
+    /* A bit for every framebuffer row that was written since the last update */
+    uint8_t *dirty_rows;
+    /* Parts of the backbuffer drawn since the last update, merged when they are close */
+    SDL_Rect dirty_rects[FY_SCREEN_MAX_DIRTY_RECTS];
+    size_t dirty_rect_amount;
+    bool all_dirty;
+    /* Tiles loaded by int 49, which can be loaded before the window is opened */
+    uint8_t tiles[FY_SCREEN_TILE_AMOUNT][FY_SCREEN_TILE_SIZE * FY_SCREEN_TILE_SIZE];
+    /* Set for tiles without transparent pixels, which are copied row by row */
+    bool tile_opaque[FY_SCREEN_TILE_AMOUNT];
+};
+
+extern SDL_Color Fy_screenPalette[FY_SCREEN_PALETTE_SIZE];
+
+void Fy_Screen_Init(Fy_Screen *out, Fy_ScreenOptions *options);
+void Fy_Screen_Destruct(Fy_Screen *screen);
+bool Fy_Screen_open(Fy_Screen *screen, int width, int height, int scale);
+bool Fy_Screen_isOpen(Fy_Screen *screen);
+bool Fy_Screen_hasWindow(Fy_Screen *screen);
+bool Fy_Screen_isValidColor(uint16_t color);
+bool Fy_Screen_containsPixel(Fy_Screen *screen, int x, int y);
+void Fy_Screen_markAllDirty(Fy_Screen *screen);
+void Fy_Screen_setPixel(Fy_Screen *screen, int x, int y, uint8_t color);
+void Fy_Screen_fillRect(Fy_Screen *screen, int x, int y, int width, int height, uint8_t color);
+void Fy_Screen_blit(Fy_Screen *screen, int x, int y, int width, int height, const uint8_t *colors);
+bool Fy_Screen_loadTile(Fy_Screen *screen, uint8_t id, const uint8_t *pixels);
+void Fy_Screen_drawTilemap(Fy_Screen *screen, const uint8_t *map, int map_width, int map_height, int x, int y);
+void Fy_Screen_drawSprite(Fy_Screen *screen, uint8_t tile, int x, int y, uint8_t flags);
+bool Fy_Screen_mapFramebuffer(Fy_Screen *screen, const uint8_t *memory, uint16_t address);
+void Fy_Screen_markWritten(Fy_Screen *screen, uint16_t address, uint32_t length);
+bool Fy_Screen_update(Fy_Screen *screen);
+
+#endif /* FY_SCREEN_H */
@@ -19,3 +19,28 @@ void Fy_Time_getTimeSince(Fy_Time *start, Fy_Time *out) {
         out->milliseconds =  now.milliseconds - start->milliseconds;
     }
 }
+
+/* Returns milliseconds from an arbitrary point that is not affected by clock changes */
+uint64_t Fy_Time_getMonotonicMilliseconds(void) {
+    struct timespec tm;
+    clock_gettime(CLOCK_MONOTONIC, &tm);
+    return (uint64_t)tm.tv_sec * 1000 + tm.tv_nsec / 1000000;
+}
+
+/*
+ * Blocks until the monotonic clock reaches `deadline` (in milliseconds).
+ * Returns false if the sleep was cut short by an exit signal.
+ */
+bool Fy_Time_sleepUntil(uint64_t deadline) {
+    struct timespec tm;
+
+    tm.tv_sec = deadline / 1000;
+    tm.tv_nsec = (deadline % 1000) * 1000000;
+
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &tm, NULL) == EINTR) {
+        if (Fy_hadExitSignal)
+            return false;
+    }
+
+    return true;
+}
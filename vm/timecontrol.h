@@ -2,6 +2,7 @@
 #define FY_TIMECONTROL_H
 
 #include <inttypes.h>
+#include <stdbool.h>
 
 typedef struct Fy_Time Fy_Time;
 
@@ -12,5 +13,7 @@ struct Fy_Time {
 
 void Fy_Time_Init(Fy_Time *out);
 void Fy_Time_getTimeSince(Fy_Time *start, Fy_Time *out);
+uint64_t Fy_Time_getMonotonicMilliseconds(void);
+bool Fy_Time_sleepUntil(uint64_t deadline);
 
 #endif /* FY_TIMECONTROL_H */
@@ -0,0 +1,209 @@
+#include "fy.h"
+
+/* The SIMD kernels are compiled for their own targets and picked at runtime, so they need GCC or Clang on x86 */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FY_VECTOR_X86
+#include <immintrin.h>
+#define FY_VECTOR_SSE2_TARGET __attribute__((target("sse2")))
+#define FY_VECTOR_AVX2_TARGET __attribute__((target("avx2")))
+#endif
+
+/* Runs on the first `length` bytes it can handle in whole blocks and returns how many that was */
+typedef size_t (*Fy_VectorKernel)(Fy_VectorOperator operator, uint16_t flags, uint8_t *dest, const uint8_t *lhs,
+                                  const uint8_t *rhs, uint16_t scalar, size_t length);
+
+static bool Fy_Vector_detected = false;
+static Fy_VectorKernel Fy_Vector_kernel = NULL;
+
+bool Fy_Vector_isValidOperator(uint8_t operator) {
+    return operator <= Fy_VectorOperator_Cmpeq;
+}
+
+static uint16_t Fy_Vector_applyScalar(Fy_VectorOperator operator, bool words, bool is_signed, uint16_t a, uint16_t b) {
+    uint16_t mask = words ? 0xffff : 0xff;
+    int32_t ordered_a, ordered_b;
+
+    if (is_signed) {
+        ordered_a = words ? (int16_t)a : (int8_t)a;
+        ordered_b = words ? (int16_t)b : (int8_t)b;
+    } else {
+        ordered_a = a;
+        ordered_b = b;
+    }
+
+    switch (operator) {
+    case Fy_VectorOperator_Add:
+        return (a + b) & mask;
+    case Fy_VectorOperator_Sub:
+        return (a - b) & mask;
+    case Fy_VectorOperator_And:
+        return a & b;
+    case Fy_VectorOperator_Or:
+        return a | b;
+    case Fy_VectorOperator_Xor:
+        return a ^ b;
+    case Fy_VectorOperator_Min:
+        return ordered_a <= ordered_b ? a : b;
+    case Fy_VectorOperator_Max:
+        return ordered_a >= ordered_b ? a : b;
+    case Fy_VectorOperator_Cmpeq:
+        return a == b ? mask : 0;
+    default:
+        FY_UNREACHABLE();
+        return a;
+    }
+}
+
+/* Handles any amount of elements, one at a time */
+static void Fy_Vector_runScalar(Fy_VectorOperator operator, uint16_t flags, uint8_t *dest, const uint8_t *lhs,
+                                const uint8_t *rhs, uint16_t scalar, size_t count) {
+    bool is_signed = flags & FY_VECTOR_SIGNED;
+
+    if (flags & FY_VECTOR_WORDS) {
+        for (size_t i = 0; i < count * 2; i += 2) {
+            uint16_t a = lhs[i] | (lhs[i + 1] << 8); // Little-endian
+            uint16_t b = rhs ? rhs[i] | (rhs[i + 1] << 8) : scalar;
+            uint16_t result = Fy_Vector_applyScalar(operator, true, is_signed, a, b);
+            dest[i] = result & 0xff;
+            dest[i + 1] = result >> 8;
+        }
+    } else {
+        for (size_t i = 0; i < count; ++i) {
+            uint8_t b = rhs ? rhs[i] : (uint8_t)scalar;
+            dest[i] = (uint8_t)Fy_Vector_applyScalar(operator, false, is_signed, lhs[i], b);
+        }
+    }
+}
+
+#ifdef FY_VECTOR_X86
+
+FY_VECTOR_SSE2_TARGET
+static inline __m128i Fy_Vector_applySse2(Fy_VectorOperator operator, bool words, bool is_signed, __m128i a, __m128i b) {
+    // SSE2 only has signed word and unsigned byte min/max, so the other kinds flip the sign bits around them
+    __m128i bias = words ? _mm_set1_epi16((short)0x8000) : _mm_set1_epi8((char)0x80);
+    bool biased = words != is_signed;
+
+    switch (operator) {
+    case Fy_VectorOperator_Add:
+        return words ? _mm_add_epi16(a, b) : _mm_add_epi8(a, b);
+    case Fy_VectorOperator_Sub:
+        return words ? _mm_sub_epi16(a, b) : _mm_sub_epi8(a, b);
+    case Fy_VectorOperator_And:
+        return _mm_and_si128(a, b);
+    case Fy_VectorOperator_Or:
+        return _mm_or_si128(a, b);
+    case Fy_VectorOperator_Xor:
+        return _mm_xor_si128(a, b);
+    case Fy_VectorOperator_Min:
+    case Fy_VectorOperator_Max: {
+        __m128i result;
+        if (biased) {
+            a = _mm_xor_si128(a, bias);
+            b = _mm_xor_si128(b, bias);
+        }
+        if (operator == Fy_VectorOperator_Min)
+            result = words ? _mm_min_epi16(a, b) : _mm_min_epu8(a, b);
+        else
+            result = words ? _mm_max_epi16(a, b) : _mm_max_epu8(a, b);
+        return biased ? _mm_xor_si128(result, bias) : result;
+    }
+    case Fy_VectorOperator_Cmpeq:
+        return words ? _mm_cmpeq_epi16(a, b) : _mm_cmpeq_epi8(a, b);
+    default:
+        FY_UNREACHABLE();
+        return a;
+    }
+}
+
+FY_VECTOR_SSE2_TARGET
+static size_t Fy_Vector_runSse2(Fy_VectorOperator operator, uint16_t flags, uint8_t *dest, const uint8_t *lhs,
+                                const uint8_t *rhs, uint16_t scalar, size_t length) {
+    bool words = flags & FY_VECTOR_WORDS;
+    bool is_signed = flags & FY_VECTOR_SIGNED;
+    __m128i broadcast = words ? _mm_set1_epi16((short)scalar) : _mm_set1_epi8((char)scalar);
+    size_t i;
+
+    for (i = 0; i + 16 <= length; i += 16) {
+        __m128i a = _mm_loadu_si128((const __m128i*)(lhs + i));
+        __m128i b = rhs ? _mm_loadu_si128((const __m128i*)(rhs + i)) : broadcast;
+        _mm_storeu_si128((__m128i*)(dest + i), Fy_Vector_applySse2(operator, words, is_signed, a, b));
+    }
+    return i;
+}
+
+FY_VECTOR_AVX2_TARGET
+static inline __m256i Fy_Vector_applyAvx2(Fy_VectorOperator operator, bool words, bool is_signed, __m256i a, __m256i b) {
+    switch (operator) {
+    case Fy_VectorOperator_Add:
+        return words ? _mm256_add_epi16(a, b) : _mm256_add_epi8(a, b);
+    case Fy_VectorOperator_Sub:
+        return words ? _mm256_sub_epi16(a, b) : _mm256_sub_epi8(a, b);
+    case Fy_VectorOperator_And:
+        return _mm256_and_si256(a, b);
+    case Fy_VectorOperator_Or:
+        return _mm256_or_si256(a, b);
+    case Fy_VectorOperator_Xor:
+        return _mm256_xor_si256(a, b);
+    case Fy_VectorOperator_Min:
+        if (words)
+            return is_signed ? _mm256_min_epi16(a, b) : _mm256_min_epu16(a, b);
+        return is_signed ? _mm256_min_epi8(a, b) : _mm256_min_epu8(a, b);
+    case Fy_VectorOperator_Max:
+        if (words)
+            return is_signed ? _mm256_max_epi16(a, b) : _mm256_max_epu16(a, b);
+        return is_signed ? _mm256_max_epi8(a, b) : _mm256_max_epu8(a, b);
+    case Fy_VectorOperator_Cmpeq:
+        return words ? _mm256_cmpeq_epi16(a, b) : _mm256_cmpeq_epi8(a, b);
+    default:
+        FY_UNREACHABLE();
+        return a;
+    }
+}
+
+FY_VECTOR_AVX2_TARGET
+static size_t Fy_Vector_runAvx2(Fy_VectorOperator operator, uint16_t flags, uint8_t *dest, const uint8_t *lhs,
+                                const uint8_t *rhs, uint16_t scalar, size_t length) {
+    bool words = flags & FY_VECTOR_WORDS;
+    bool is_signed = flags & FY_VECTOR_SIGNED;
+    __m256i broadcast = words ? _mm256_set1_epi16((short)scalar) : _mm256_set1_epi8((char)scalar);
+    size_t i;
+
+    for (i = 0; i + 32 <= length; i += 32) {
+        __m256i a = _mm256_loadu_si256((const __m256i*)(lhs + i));
+        __m256i b = rhs ? _mm256_loadu_si256((const __m256i*)(rhs + i)) : broadcast;
+        _mm256_storeu_si256((__m256i*)(dest + i), Fy_Vector_applyAvx2(operator, words, is_signed, a, b));
+    }
+    return i;
+}
+
+#endif /* FY_VECTOR_X86 */
+
+/* Picks the widest kernel the host supports */
+static void Fy_Vector_detect(void) {
+#ifdef FY_VECTOR_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        Fy_Vector_kernel = Fy_Vector_runAvx2;
+    else if (__builtin_cpu_supports("sse2"))
+        Fy_Vector_kernel = Fy_Vector_runSse2;
+#endif
+    Fy_Vector_detected = true;
+}
+
+/*
+ * Runs `operator` on `count` elements of `lhs` and `rhs` into `dest`, which may be the same as one of the operands.
+ * If `rhs` is NULL, `scalar` is used as the rhs of every element.
+ */
+void Fy_Vector_run(Fy_VectorOperator operator, uint16_t flags, uint8_t *dest, const uint8_t *lhs, const uint8_t *rhs,
+                   uint16_t scalar, size_t count) {
+    size_t width = flags & FY_VECTOR_WORDS ? 2 : 1;
+    size_t done = 0;
+
+    if (!Fy_Vector_detected)
+        Fy_Vector_detect();
+    if (Fy_Vector_kernel)
+        done = Fy_Vector_kernel(operator, flags, dest, lhs, rhs, scalar, count * width);
+
+    // The tail that doesn't fill a whole block
+    Fy_Vector_runScalar(operator, flags, dest + done, lhs + done, rhs ? rhs + done : NULL, scalar, count - done / width);
+}
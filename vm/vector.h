@@ -0,0 +1,31 @@
+#ifndef FY_VECTOR_H
+#define FY_VECTOR_H
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Flags given above the operator id in `si` to the vector interrupt */
+#define FY_VECTOR_WORDS (1 << 8)
+#define FY_VECTOR_SIGNED (1 << 9)
+#define FY_VECTOR_SCALAR (1 << 10)
+
+typedef enum Fy_VectorOperator Fy_VectorOperator;
+
+enum Fy_VectorOperator {
+    Fy_VectorOperator_Add = 0,
+    Fy_VectorOperator_Sub,
+    Fy_VectorOperator_And,
+    Fy_VectorOperator_Or,
+    Fy_VectorOperator_Xor,
+    Fy_VectorOperator_Min,
+    Fy_VectorOperator_Max,
+    /* Sets equal elements to all ones and the rest to zero */
+    Fy_VectorOperator_Cmpeq
+};
+
+bool Fy_Vector_isValidOperator(uint8_t operator);
+void Fy_Vector_run(Fy_VectorOperator operator, uint16_t flags, uint8_t *dest, const uint8_t *lhs, const uint8_t *rhs,
+                   uint16_t scalar, size_t count);
+
+#endif /* FY_VECTOR_H */
@@ -1,12 +1,19 @@
 #include "fy.h"
 
+#include <math.h>
+
 /* Declare functions */
 static void Fy_VM_setResult16InFlags(Fy_VM *vm, int16_t res);
 static void Fy_VM_setResult8InFlags(Fy_VM *vm, int8_t res);
+static void Fy_VM_setFlag(Fy_VM *vm, uint8_t flag, bool enable);
 static uint16_t Fy_VM_add16(Fy_VM *vm, uint16_t lhs, uint16_t rhs);
 static uint16_t Fy_VM_sub16(Fy_VM *vm, uint16_t lhs, uint16_t rhs);
 static uint8_t Fy_VM_add8(Fy_VM *vm, uint8_t lhs, uint8_t rhs);
 static uint8_t Fy_VM_sub8(Fy_VM *vm, uint8_t lhs, uint8_t rhs);
+static uint16_t Fy_VM_adc16(Fy_VM *vm, uint16_t lhs, uint16_t rhs);
+static uint16_t Fy_VM_sbb16(Fy_VM *vm, uint16_t lhs, uint16_t rhs);
+static uint8_t Fy_VM_adc8(Fy_VM *vm, uint8_t lhs, uint8_t rhs);
+static uint8_t Fy_VM_sbb8(Fy_VM *vm, uint8_t lhs, uint8_t rhs);
 
 /*
  * Reads all of the binary file into `out`.
@@ -114,10 +121,14 @@ static char *Fy_RuntimeError_toString(Fy_RuntimeError error) {
         return "Interrupt not found";
     case Fy_RuntimeError_InterruptError:
         return "Interrupt error";
+    case Fy_RuntimeError_PixelNotInScreen:
+        return "Pixel not in screen";
     case Fy_RuntimeError_DivisionByZero:
         return "Division by zero";
     case Fy_RuntimeError_DivisionResultTooBig:
         return "Division result too big";
+    case Fy_RuntimeError_FloatRegNotFound:
+        return "Could not find float register from opcode";
     default:
         FY_UNREACHABLE();
     }
@@ -131,7 +142,7 @@ static uint16_t Fy_alignWord(uint16_t w, uint16_t a) {
         return w + (a - w % a) + a;
 }
 
-void Fy_VM_Init(Fy_BytecodeFileStream *bc, Fy_VM *out) {
+void Fy_VM_Init(Fy_BytecodeFileStream *bc, Fy_VMOptions *options, Fy_VM *out) {
     uint16_t data_size, code_size, stack_size;
     uint16_t data_offset, code_offset, stack_offset;
 
@@ -159,33 +170,40 @@ void Fy_VM_Init(Fy_BytecodeFileStream *bc, Fy_VM *out) {
     out->reg_ip = code_offset;
     out->reg_sp = stack_offset;
     out->reg_bp = 0;
+    out->reg_si = 0;
+    out->reg_di = 0;
+    memset(out->reg_r, 0, sizeof(out->reg_r));
+    memset(out->reg_f, 0, sizeof(out->reg_f));
     out->running = true;
     out->error = false;
     out->flags = 0;
-    out->window = NULL;
-    out->surface = NULL;
-
+    out->keyboard.has_key = false;
+    out->irq.in_handler = false;
+    out->irq.has_timer_handler = false;
+    out->irq.timer_countdown = FY_VM_TIMER_CHECK_INTERVAL;
+    out->irq.has_keyboard_handler = false;
+    Fy_Screen_Init(&out->screen, &options->screen);
+
+    if (!Fy_Output_Init(&out->output, options->flush_policy, options->output_thread))
+        fprintf(stderr, "Couldn't start output thread, writing output directly\n");
+    Fy_Hashtables_Init(&out->hashtables);
+    // The stack is right after the code, so the heap gets everything above it (a stack offset of 0 means it wrapped)
+    Fy_Heap_Init(&out->heap, stack_offset != 0 ? stack_offset : (1 << 16), 1 << 16);
+    Fy_Random_Init(&out->random, options->has_seed ? options->seed : Fy_Random_getTimeSeed());
     Fy_Time_Init(&out->start_time);
 }
 
 void Fy_VM_Destruct(Fy_VM *vm) {
-    if (vm->window) {
-        SDL_FreeSurface(vm->surface);
-        SDL_DestroyWindow(vm->window);
-        SDL_Quit();
-    }
+    Fy_Output_Destruct(&vm->output);
+    Fy_Hashtables_Destruct(&vm->hashtables);
+    Fy_Heap_Destruct(&vm->heap);
+    Fy_Screen_Destruct(&vm->screen);
     free(vm->mem_space_bottom);
 }
 
-uint16_t Fy_VM_generateRandom(Fy_VM *vm) {
-    uint16_t n = vm->random_seed;
-    srand(n);
-    vm->random_seed = rand();
-    return n;
-}
-
 void Fy_VM_runtimeError(Fy_VM *vm, Fy_RuntimeError err, char *additional, ...) {
-    (void)vm;
+    // Show the output the program made before the error
+    Fy_Output_sync(&vm->output);
     printf("RuntimeError: %s", Fy_RuntimeError_toString(err));
     if (additional) {
         va_list va;
@@ -207,16 +225,132 @@ uint8_t Fy_VM_getMem8(Fy_VM *vm, uint16_t address) {
 uint16_t Fy_VM_getMem16(Fy_VM *vm, uint16_t address) {
     // assert(address <= vm->mem_size - 2);
     // Little endian
-    return ((uint16_t)vm->mem_space_bottom[address]) + ((uint16_t)vm->mem_space_bottom[address + 1] << 8);
+    return ((uint16_t)vm->mem_space_bottom[address]) + ((uint16_t)vm->mem_space_bottom[(uint16_t)(address + 1)] << 8);
+}
+
+/* Lets the screen know `length` bytes were written at `address`, the range may wrap around memory */
+void Fy_VM_markMemWritten(Fy_VM *vm, uint16_t address, uint32_t length) {
+    uint32_t until_wrap = (1 << 16) - (uint32_t)address;
+
+    if (!vm->screen.framebuffer)
+        return;
+    if (length <= until_wrap) {
+        Fy_Screen_markWritten(&vm->screen, address, length);
+    } else {
+        Fy_Screen_markWritten(&vm->screen, address, until_wrap);
+        Fy_Screen_markWritten(&vm->screen, 0, length - until_wrap);
+    }
 }
 
 void Fy_VM_setMem16(Fy_VM *vm, uint16_t address, uint16_t value) {
     vm->mem_space_bottom[address] = (uint8_t)(value & 0xff);
-    vm->mem_space_bottom[address + 1] = (uint8_t)(value >> 8);
+    vm->mem_space_bottom[(uint16_t)(address + 1)] = (uint8_t)(value >> 8);
+    Fy_VM_markMemWritten(vm, address, 2);
 }
 
 void Fy_VM_setMem8(Fy_VM *vm, uint16_t address, uint8_t value) {
     vm->mem_space_bottom[address] = value;
+    Fy_VM_markMemWritten(vm, address, 1);
+}
+
+/* Returns how many bytes from `address` can be accessed before wrapping around memory */
+static uint32_t Fy_VM_bytesUntilWrap(uint16_t address, uint32_t length) {
+    uint32_t until_wrap = (1 << 16) - (uint32_t)address;
+    return length < until_wrap ? length : until_wrap;
+}
+
+/* Copies `length` bytes of memory into `out`, wrapping around the end of memory */
+void Fy_VM_readMemInto(Fy_VM *vm, uint16_t address, uint8_t *out, uint32_t length) {
+    while (length > 0) {
+        uint32_t amount = Fy_VM_bytesUntilWrap(address, length);
+        memcpy(out, &vm->mem_space_bottom[address], amount);
+        out += amount;
+        address += amount;
+        length -= amount;
+    }
+}
+
+/* Copies `length` bytes from `data` into memory, wrapping around the end of memory */
+void Fy_VM_writeMemFrom(Fy_VM *vm, uint16_t address, const uint8_t *data, uint32_t length) {
+    Fy_VM_markMemWritten(vm, address, length);
+    while (length > 0) {
+        uint32_t amount = Fy_VM_bytesUntilWrap(address, length);
+        memcpy(&vm->mem_space_bottom[address], data, amount);
+        data += amount;
+        address += amount;
+        length -= amount;
+    }
+}
+
+/* Copies `length` bytes from `src` to `dest`, the ranges may overlap like in memmove */
+void Fy_VM_copyMem(Fy_VM *vm, uint16_t dest, uint16_t src, uint32_t length) {
+    uint8_t *temp;
+
+    if (length == 0 || dest == src)
+        return;
+
+    // Common case, neither range wraps around memory
+    if ((uint32_t)src + length <= (1 << 16) && (uint32_t)dest + length <= (1 << 16)) {
+        memmove(&vm->mem_space_bottom[dest], &vm->mem_space_bottom[src], length);
+        Fy_VM_markMemWritten(vm, dest, length);
+        return;
+    }
+
+    temp = malloc(length * sizeof(uint8_t));
+    Fy_VM_readMemInto(vm, src, temp, length);
+    Fy_VM_writeMemFrom(vm, dest, temp, length);
+    free(temp);
+}
+
+/* Sets `length` bytes starting at `dest` to `value` */
+void Fy_VM_fillMem8(Fy_VM *vm, uint16_t dest, uint8_t value, uint32_t length) {
+    Fy_VM_markMemWritten(vm, dest, length);
+    while (length > 0) {
+        uint32_t amount = Fy_VM_bytesUntilWrap(dest, length);
+        memset(&vm->mem_space_bottom[dest], value, amount);
+        dest += amount;
+        length -= amount;
+    }
+}
+
+/* Sets `count` words starting at `dest` to `value` */
+void Fy_VM_fillMem16(Fy_VM *vm, uint16_t dest, uint16_t value, uint32_t count) {
+    // Words made of two equal bytes are just a byte fill
+    if ((value & 0xff) == (value >> 8)) {
+        Fy_VM_fillMem8(vm, dest, (uint8_t)value, count * 2);
+        return;
+    }
+    while (count > 0) {
+        Fy_VM_setMem16(vm, dest, value);
+        dest += 2;
+        --count;
+    }
+}
+
+/* Returns the index of the first byte that differs between the two ranges, or `length` if they are equal */
+uint32_t Fy_VM_compareMem(Fy_VM *vm, uint16_t address1, uint16_t address2, uint32_t length) {
+    uint32_t idx = 0;
+
+    while (idx < length) {
+        uint32_t amount = Fy_VM_bytesUntilWrap(address1, length - idx);
+        uint8_t *ptr1, *ptr2;
+
+        amount = Fy_VM_bytesUntilWrap(address2, amount);
+        ptr1 = &vm->mem_space_bottom[address1];
+        ptr2 = &vm->mem_space_bottom[address2];
+        // Let memcmp skip the equal part and only look for the exact byte once it fails
+        if (memcmp(ptr1, ptr2, amount) != 0) {
+            uint32_t i = 0;
+            while (ptr1[i] == ptr2[i])
+                ++i;
+            return idx + i;
+        }
+        address1 += amount;
+        address2 += amount;
+        idx += amount;
+    }
+
+    return length;
 }
 
 static uint8_t *Fy_VM_getDividedReg16Ptr(Fy_VM *vm, uint8_t reg) {
@@ -251,6 +385,22 @@ static uint16_t *Fy_VM_getReg16Ptr(Fy_VM *vm, uint8_t reg) {
     case Fy_Reg16_Bp:
         reg_ptr = &vm->reg_bp;
         break;
+    case Fy_Reg16_Si:
+        reg_ptr = &vm->reg_si;
+        break;
+    case Fy_Reg16_Di:
+        reg_ptr = &vm->reg_di;
+        break;
+    case Fy_Reg16_R8:
+    case Fy_Reg16_R9:
+    case Fy_Reg16_R10:
+    case Fy_Reg16_R11:
+    case Fy_Reg16_R12:
+    case Fy_Reg16_R13:
+    case Fy_Reg16_R14:
+    case Fy_Reg16_R15:
+        reg_ptr = &vm->reg_r[reg - Fy_Reg16_R8];
+        break;
     default:
         reg_ptr = NULL;
     }
@@ -338,6 +488,25 @@ bool Fy_VM_setReg8(Fy_VM *vm, uint8_t reg, uint8_t value) {
     return true;
 }
 
+bool Fy_VM_getRegFloat(Fy_VM *vm, uint8_t reg, float *out) {
+    if (reg > Fy_RegFloat_F7) {
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_FloatRegNotFound, "'%X'", reg);
+        return false;
+    }
+    *out = vm->reg_f[reg];
+    return true;
+}
+
+/* Unlike the integer registers, setting a float register doesn't change the flags */
+bool Fy_VM_setRegFloat(Fy_VM *vm, uint8_t reg, float value) {
+    if (reg > Fy_RegFloat_F7) {
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_FloatRegNotFound, "'%X'", reg);
+        return false;
+    }
+    vm->reg_f[reg] = value;
+    return true;
+}
+
 bool Fy_VM_isWritableReg16(Fy_VM *vm, uint8_t reg) {
     if (Fy_VM_getReg16Ptr(vm, reg))
         return true;
@@ -390,6 +559,12 @@ bool Fy_VM_runBinaryOperatorOnReg16(Fy_VM *vm, Fy_BinaryOperator operator, uint8
         reg_value = Fy_VM_sub16(vm, reg_value, value);
         set_in_reg = false;
         break;
+    case Fy_BinaryOperator_Adc:
+        reg_value = Fy_VM_adc16(vm, reg_value, value);
+        break;
+    case Fy_BinaryOperator_Sbb:
+        reg_value = Fy_VM_sbb16(vm, reg_value, value);
+        break;
     default:
         Fy_VM_runtimeError(vm, Fy_RuntimeError_InvalidOpcode, "Invalid operator opcode '%d'", operator);
         return false;
@@ -445,6 +620,12 @@ bool Fy_VM_runBinaryOperatorOnReg8(Fy_VM *vm, Fy_BinaryOperator operator, uint8_
         reg_value = Fy_VM_sub8(vm, reg_value, value);
         set_in_reg = false;
         break;
+    case Fy_BinaryOperator_Adc:
+        reg_value = Fy_VM_adc8(vm, reg_value, value);
+        break;
+    case Fy_BinaryOperator_Sbb:
+        reg_value = Fy_VM_sbb8(vm, reg_value, value);
+        break;
     default:
         Fy_VM_runtimeError(vm, Fy_RuntimeError_InvalidOpcode, "Invalid operator opcode '%d'", operator);
         return false;
@@ -499,6 +680,12 @@ bool Fy_VM_runBinaryOperatorOnMem16(Fy_VM *vm, Fy_BinaryOperator operator, uint1
         mem_value = Fy_VM_sub16(vm, mem_value, value);
         set_in_mem = false;
         break;
+    case Fy_BinaryOperator_Adc:
+        mem_value = Fy_VM_adc16(vm, mem_value, value);
+        break;
+    case Fy_BinaryOperator_Sbb:
+        mem_value = Fy_VM_sbb16(vm, mem_value, value);
+        break;
     default:
         Fy_VM_runtimeError(vm, Fy_RuntimeError_InvalidOpcode, "Invalid operator opcode '%d'", operator);
         return false;
@@ -550,6 +737,12 @@ bool Fy_VM_runBinaryOperatorOnMem8(Fy_VM *vm, Fy_BinaryOperator operator, uint16
         mem_value = Fy_VM_sub8(vm, mem_value, value);
         set_in_mem = false;
         break;
+    case Fy_BinaryOperator_Adc:
+        mem_value = Fy_VM_adc8(vm, mem_value, value);
+        break;
+    case Fy_BinaryOperator_Sbb:
+        mem_value = Fy_VM_sbb8(vm, mem_value, value);
+        break;
     default:
         Fy_VM_runtimeError(vm, Fy_RuntimeError_InvalidOpcode, "Invalid operator opcode '%d'", operator);
         return false;
@@ -564,6 +757,136 @@ bool Fy_VM_runBinaryOperatorOnMem8(Fy_VM *vm, Fy_BinaryOperator operator, uint16
     return true;
 }
 
+/* Sets `reg_id` to `lhs` `operator` `rhs`, the operands are read before the register is written */
+bool Fy_VM_runBinaryOperator3OnReg16(Fy_VM *vm, Fy_BinaryOperator operator, uint8_t reg_id, uint16_t lhs, uint16_t rhs) {
+    // Setting the register also sets the zero and sign flags, the operator overrides them anyway
+    if (!Fy_VM_setReg16(vm, reg_id, lhs))
+        return false;
+    return Fy_VM_runBinaryOperatorOnReg16(vm, operator, reg_id, rhs);
+}
+
+/* Sets `reg_id` to `lhs` `operator` `rhs`, the operands are read before the register is written */
+bool Fy_VM_runBinaryOperator3OnReg8(Fy_VM *vm, Fy_BinaryOperator operator, uint8_t reg_id, uint8_t lhs, uint8_t rhs) {
+    if (!Fy_VM_setReg8(vm, reg_id, lhs))
+        return false;
+    return Fy_VM_runBinaryOperatorOnReg8(vm, operator, reg_id, rhs);
+}
+
+/* Runs a 32-bit operator with dx:ax as the destination */
+bool Fy_VM_runOperator32(Fy_VM *vm, Fy_BinaryOperator operator, uint32_t value) {
+    uint16_t low, high;
+    uint32_t lhs, result;
+    bool set_in_regs = true;
+
+    if (!Fy_VM_getReg16(vm, Fy_Reg16_Ax, &low) || !Fy_VM_getReg16(vm, Fy_Reg16_Dx, &high))
+        return false;
+    lhs = ((uint32_t)high << 16) | low;
+
+    switch (operator) {
+    case Fy_BinaryOperator_Add:
+        result = lhs + value;
+        Fy_VM_setFlag(vm, FY_FLAGS_CARRY, result < lhs);
+        Fy_VM_setFlag(vm, FY_FLAGS_OVERFLOW, ((lhs ^ result) & (value ^ result)) >> 31);
+        break;
+    case Fy_BinaryOperator_Sub:
+    case Fy_BinaryOperator_Cmp:
+        result = lhs - value;
+        Fy_VM_setFlag(vm, FY_FLAGS_CARRY, lhs < value);
+        Fy_VM_setFlag(vm, FY_FLAGS_OVERFLOW, ((lhs ^ value) & (lhs ^ result)) >> 31);
+        set_in_regs = operator != Fy_BinaryOperator_Cmp;
+        break;
+    case Fy_BinaryOperator_Shl:
+        result = value < 32 ? lhs << value : 0;
+        break;
+    case Fy_BinaryOperator_Shr:
+        result = value < 32 ? lhs >> value : 0;
+        break;
+    default:
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_InvalidOpcode, "Invalid 32-bit operator opcode '%d'", operator);
+        return false;
+    }
+
+    if (set_in_regs) {
+        if (!Fy_VM_setReg16(vm, Fy_Reg16_Ax, (uint16_t)result) || !Fy_VM_setReg16(vm, Fy_Reg16_Dx, (uint16_t)(result >> 16)))
+            return false;
+    }
+    // Setting the registers changed the flags, so set them from the full result
+    Fy_VM_setFlag(vm, FY_FLAGS_ZERO, result == 0);
+    Fy_VM_setFlag(vm, FY_FLAGS_SIGN, result >> 31);
+    return true;
+}
+
+/* Returns whether the flags satisfy the condition */
+bool Fy_VM_isConditionMet(Fy_VM *vm, Fy_Condition condition) {
+    bool zero = vm->flags & FY_FLAGS_ZERO;
+    bool carry = vm->flags & FY_FLAGS_CARRY;
+    bool less = !!(vm->flags & FY_FLAGS_SIGN) != !!(vm->flags & FY_FLAGS_OVERFLOW);
+
+    switch (condition) {
+    case Fy_Condition_E:
+        return zero;
+    case Fy_Condition_Ne:
+        return !zero;
+    case Fy_Condition_B:
+        return carry && !zero;
+    case Fy_Condition_Be:
+        return carry || zero;
+    case Fy_Condition_A:
+        return !carry && !zero;
+    case Fy_Condition_Ae:
+        return !carry || zero;
+    case Fy_Condition_L:
+        return less && !zero;
+    case Fy_Condition_Le:
+        return less || zero;
+    case Fy_Condition_G:
+        return !less && !zero;
+    case Fy_Condition_Ge:
+        return !less || zero;
+    default:
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_InvalidOpcode, "Invalid condition id '%d'", condition);
+        return false;
+    }
+}
+
+/*
+ * Runs an FPU operator with the float register as the destination.
+ * Comparisons set the flags like an unsigned comparison, and an unordered result (NaN) sets both zero and carry.
+ */
+bool Fy_VM_runFpuOperator(Fy_VM *vm, Fy_FpuOperator operator, uint8_t reg_id, float value) {
+    float lhs;
+
+    if (!Fy_VM_getRegFloat(vm, reg_id, &lhs))
+        return false;
+
+    switch (operator) {
+    case Fy_FpuOperator_Mov:
+        return Fy_VM_setRegFloat(vm, reg_id, value);
+    case Fy_FpuOperator_Add:
+        return Fy_VM_setRegFloat(vm, reg_id, lhs + value);
+    case Fy_FpuOperator_Sub:
+        return Fy_VM_setRegFloat(vm, reg_id, lhs - value);
+    case Fy_FpuOperator_Mul:
+        return Fy_VM_setRegFloat(vm, reg_id, lhs * value);
+    case Fy_FpuOperator_Div:
+        return Fy_VM_setRegFloat(vm, reg_id, lhs / value);
+    case Fy_FpuOperator_Sqrt:
+        return Fy_VM_setRegFloat(vm, reg_id, sqrtf(value));
+    case Fy_FpuOperator_Cmp: {
+        bool unordered = isnan(lhs) || isnan(value);
+        Fy_VM_setFlag(vm, FY_FLAGS_ZERO, unordered || lhs == value);
+        Fy_VM_setFlag(vm, FY_FLAGS_CARRY, unordered || lhs < value);
+        // Also allow the signed jumps
+        Fy_VM_setFlag(vm, FY_FLAGS_SIGN, lhs < value);
+        Fy_VM_setFlag(vm, FY_FLAGS_OVERFLOW, false);
+        return true;
+    }
+    default:
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_InvalidOpcode, "Invalid FPU operator opcode '%d'", operator);
+        return false;
+    }
+}
+
 static bool Fy_VM_runUnaryOperator16(Fy_VM *vm, Fy_UnaryOperator operator, uint16_t *value) {
     switch (operator) {
     case Fy_UnaryOperator_Neg:
@@ -681,28 +1004,35 @@ static void Fy_VM_runInstruction(Fy_VM *vm) {
     }
 }
 
+static void Fy_VM_handleEvent(Fy_VM *vm, SDL_Event *event) {
+    switch (event->type) {
+    case SDL_KEYDOWN:
+        vm->keyboard.has_key = true;
+        vm->keyboard.key_scancode = event->key.keysym.scancode;
+        break;
+    case SDL_WINDOWEVENT:
+        switch (event->window.event) {
+        case SDL_WINDOWEVENT_EXPOSED:
+            // The window system may have lost what was shown, so show everything again
+            Fy_Screen_markAllDirty(&vm->screen);
+            break;
+        case SDL_WINDOWEVENT_CLOSE:
+            // If we close the window we should exit the program
+            vm->running = false;
+            vm->error = true;
+            break;
+        }
+        break;
+    }
+}
+
 static void Fy_VM_handleEvents(Fy_VM *vm) {
     // If we have a window check window events
-    if (vm->window) {
+    if (Fy_Screen_hasWindow(&vm->screen)) {
         SDL_Event event;
         // Loop all SDL events
-        while (SDL_PollEvent(&event)) {
-            switch (event.type) {
-            case SDL_KEYDOWN:
-                vm->keyboard.has_key = true;
-                vm->keyboard.key_scancode = event.key.keysym.scancode;
-                break;
-            case SDL_WINDOWEVENT:
-                switch (event.window.event) {
-                case SDL_WINDOWEVENT_CLOSE:
-                    // If we close the window we should exit the program
-                    vm->running = false;
-                    vm->error = true;
-                    break;
-                }
-                break;
-            }
-        }
+        while (SDL_PollEvent(&event))
+            Fy_VM_handleEvent(vm, &event);
     }
     if (Fy_hadExitSignal) {
         vm->running = false;
@@ -710,11 +1040,136 @@ static void Fy_VM_handleEvents(Fy_VM *vm) {
     }
 }
 
+/*
+ * Blocks until `deadline`, the window is closed or (if `stop_on_key`) a key is pressed.
+ * Without a window there are no events to wait for, so this just sleeps.
+ */
+static void Fy_VM_waitForEvents(Fy_VM *vm, uint64_t deadline, bool stop_on_key) {
+    // The program is idle, so this is a cheap time to show its output
+    if (vm->output.policy != Fy_OutputFlushPolicy_Halt)
+        Fy_Output_flush(&vm->output);
+
+    if (!Fy_Screen_hasWindow(&vm->screen)) {
+        Fy_Time_sleepUntil(deadline);
+        return;
+    }
+
+    while (vm->running && !(stop_on_key && vm->keyboard.has_key) && !Fy_hadExitSignal) {
+        uint64_t now = Fy_Time_getMonotonicMilliseconds();
+        uint64_t wait_time;
+        SDL_Event event;
+
+        if (now >= deadline)
+            break;
+
+        // Wake up every once in a while so we notice exit signals
+        wait_time = deadline - now;
+        if (wait_time > FY_VM_WAIT_SLICE)
+            wait_time = FY_VM_WAIT_SLICE;
+
+        if (SDL_WaitEventTimeout(&event, (int)wait_time))
+            Fy_VM_handleEvent(vm, &event);
+    }
+}
+
+/* Blocks until the window is closed or `milliseconds` pass, handling window events meanwhile */
+void Fy_VM_sleep(Fy_VM *vm, uint16_t milliseconds) {
+    Fy_VM_waitForEvents(vm, Fy_Time_getMonotonicMilliseconds() + milliseconds, false);
+}
+
+/* Blocks until a key is pressed, the window is closed or `timeout` milliseconds pass */
+void Fy_VM_waitForInput(Fy_VM *vm, uint16_t timeout) {
+    Fy_VM_waitForEvents(vm, Fy_Time_getMonotonicMilliseconds() + timeout, true);
+}
+
+static bool Fy_VM_isTimerInterruptPending(Fy_VM *vm) {
+    return vm->irq.has_timer_handler && Fy_Time_getMonotonicMilliseconds() >= vm->irq.timer_deadline;
+}
+
+/* Reading the clock costs more than an instruction, so running code only reads it every few instructions */
+static bool Fy_VM_shouldCheckTimer(Fy_VM *vm) {
+    if (!vm->irq.has_timer_handler || --vm->irq.timer_countdown != 0)
+        return false;
+    vm->irq.timer_countdown = FY_VM_TIMER_CHECK_INTERVAL;
+    return true;
+}
+
+static bool Fy_VM_isKeyboardInterruptPending(Fy_VM *vm) {
+    return vm->irq.has_keyboard_handler && vm->keyboard.has_key;
+}
+
+/* Saves flags and the return address on the stack and jumps to the handler */
+static void Fy_VM_enterInterruptHandler(Fy_VM *vm, uint16_t handler) {
+    Fy_VM_pushToStack(vm, vm->flags);
+    Fy_VM_pushToStack(vm, vm->reg_ip);
+    Fy_VM_setIpToRelAddress(vm, handler);
+    vm->irq.in_handler = true;
+}
+
+/* Runs a guest handler if one of its events happened, handlers don't nest */
+static void Fy_VM_deliverInterrupts(Fy_VM *vm) {
+    if (vm->irq.in_handler || !vm->running)
+        return;
+
+    if (Fy_VM_shouldCheckTimer(vm)) {
+        uint64_t now = Fy_Time_getMonotonicMilliseconds();
+        if (now >= vm->irq.timer_deadline) {
+            vm->irq.timer_deadline += vm->irq.timer_period;
+            // Don't fire a burst of ticks if we fell behind, skip them instead
+            if (vm->irq.timer_deadline <= now)
+                vm->irq.timer_deadline = now + vm->irq.timer_period;
+            Fy_VM_enterInterruptHandler(vm, vm->irq.timer_handler);
+            return;
+        }
+    }
+    if (Fy_VM_isKeyboardInterruptPending(vm))
+        Fy_VM_enterInterruptHandler(vm, vm->irq.keyboard_handler);
+}
+
+/* Blocks until one of the installed handlers should run */
+void Fy_VM_waitForInterrupt(Fy_VM *vm) {
+    bool wake_on_key = vm->irq.has_keyboard_handler && Fy_Screen_hasWindow(&vm->screen);
+
+    if (vm->irq.in_handler) {
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_InterruptError, "can't wait for interrupts inside a handler");
+        return;
+    }
+    if (!vm->irq.has_timer_handler && !wake_on_key) {
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_InterruptError, "no handler can wake the machine");
+        return;
+    }
+
+    while (vm->running && !Fy_hadExitSignal
+           && !Fy_VM_isTimerInterruptPending(vm) && !Fy_VM_isKeyboardInterruptPending(vm)) {
+        uint64_t deadline;
+        if (vm->irq.has_timer_handler)
+            deadline = vm->irq.timer_deadline;
+        else
+            deadline = Fy_Time_getMonotonicMilliseconds() + FY_VM_WAIT_SLICE;
+        Fy_VM_waitForEvents(vm, deadline, wake_on_key);
+    }
+    // Whatever woke us should be handled right away
+    vm->irq.timer_countdown = 1;
+}
+
+/* Restores the state saved when the handler was entered */
+void Fy_VM_returnFromInterrupt(Fy_VM *vm) {
+    if (!vm->irq.in_handler) {
+        Fy_VM_runtimeError(vm, Fy_RuntimeError_InterruptError, "iret outside of a handler");
+        return;
+    }
+    vm->reg_ip = Fy_VM_popFromStack(vm);
+    vm->flags = (uint8_t)Fy_VM_popFromStack(vm);
+    vm->irq.in_handler = false;
+}
+
 /* Returns exit code */
 int Fy_VM_runAll(Fy_VM *vm) {
     while (vm->running) {
         // Handle other events
         Fy_VM_handleEvents(vm);
+        // Jump to a guest handler if one is due
+        Fy_VM_deliverInterrupts(vm);
         // Run the awaiting instructions
         Fy_VM_runInstruction(vm);
     }
@@ -748,6 +1203,40 @@ static void Fy_VM_setResult8InFlags(Fy_VM *vm, int8_t res) {
         vm->flags &= ~FY_FLAGS_SIGN; // Disable
 }
 
+/* Looks for `value` in `length` bytes from `address`, puts its address in `out` and returns whether it was found */
+bool Fy_VM_findByte(Fy_VM *vm, uint16_t address, uint8_t value, uint32_t length, uint16_t *out) {
+    while (length > 0) {
+        uint32_t amount = Fy_VM_bytesUntilWrap(address, length);
+        uint8_t *found = memchr(&vm->mem_space_bottom[address], value, amount);
+        if (found) {
+            *out = (uint16_t)(found - vm->mem_space_bottom);
+            return true;
+        }
+        address += amount;
+        length -= amount;
+    }
+    return false;
+}
+
+/* Puts the length of the NUL terminated string at `address` in `out`, returns false if there is no NUL */
+bool Fy_VM_getStringLength(Fy_VM *vm, uint16_t address, uint16_t *out) {
+    uint16_t nul_address;
+    if (!Fy_VM_findByte(vm, address, '\0', 1 << 16, &nul_address))
+        return false;
+    *out = nul_address - address;
+    return true;
+}
+
+/* Sets the flags like `cmp` would */
+void Fy_VM_compare16(Fy_VM *vm, uint16_t lhs, uint16_t rhs) {
+    Fy_VM_setResult16InFlags(vm, Fy_VM_sub16(vm, lhs, rhs));
+}
+
+/* Sets the flags like `cmp` would */
+void Fy_VM_compare8(Fy_VM *vm, uint8_t lhs, uint8_t rhs) {
+    Fy_VM_setResult8InFlags(vm, Fy_VM_sub8(vm, lhs, rhs));
+}
+
 static void Fy_VM_setOverflowFlag(Fy_VM *vm, int32_t no_error, int32_t maybe_error) {
     if (no_error != maybe_error)
         vm->flags |= FY_FLAGS_OVERFLOW;
@@ -762,6 +1251,13 @@ static void Fy_VM_setCarryFlag(Fy_VM *vm, uint32_t no_error, uint32_t maybe_erro
         vm->flags &= ~FY_FLAGS_CARRY;
 }
 
+static void Fy_VM_setFlag(Fy_VM *vm, uint8_t flag, bool enable) {
+    if (enable)
+        vm->flags |= flag;
+    else
+        vm->flags &= ~flag;
+}
+
 static uint16_t Fy_VM_add16(Fy_VM *vm, uint16_t lhs, uint16_t rhs) {
     uint16_t res = lhs + rhs;
     Fy_VM_setCarryFlag(vm, (uint32_t)lhs + (uint32_t)rhs, (uint32_t)res);
@@ -790,6 +1286,40 @@ static uint8_t Fy_VM_sub8(Fy_VM *vm, uint8_t lhs, uint8_t rhs) {
     return res;
 }
 
+/* Adds with the carry flag as an extra 1 */
+static uint16_t Fy_VM_adc16(Fy_VM *vm, uint16_t lhs, uint16_t rhs) {
+    uint16_t carry = vm->flags & FY_FLAGS_CARRY ? 1 : 0;
+    uint16_t res = lhs + rhs + carry;
+    Fy_VM_setCarryFlag(vm, (uint32_t)lhs + (uint32_t)rhs + carry, (uint32_t)res);
+    Fy_VM_setOverflowFlag(vm, (int32_t)(int16_t)lhs + (int16_t)rhs + carry, (int32_t)(int16_t)res);
+    return res;
+}
+
+/* Subtracts with the carry flag as an extra borrow */
+static uint16_t Fy_VM_sbb16(Fy_VM *vm, uint16_t lhs, uint16_t rhs) {
+    uint16_t borrow = vm->flags & FY_FLAGS_CARRY ? 1 : 0;
+    uint16_t res = lhs - rhs - borrow;
+    Fy_VM_setCarryFlag(vm, (uint32_t)lhs - (uint32_t)rhs - borrow, (uint32_t)res);
+    Fy_VM_setOverflowFlag(vm, (int32_t)(int16_t)lhs - (int16_t)rhs - borrow, (int32_t)(int16_t)res);
+    return res;
+}
+
+static uint8_t Fy_VM_adc8(Fy_VM *vm, uint8_t lhs, uint8_t rhs) {
+    uint8_t carry = vm->flags & FY_FLAGS_CARRY ? 1 : 0;
+    uint8_t res = lhs + rhs + carry;
+    Fy_VM_setCarryFlag(vm, (uint32_t)lhs + (uint32_t)rhs + carry, (uint32_t)res);
+    Fy_VM_setOverflowFlag(vm, (int32_t)(int8_t)lhs + (int8_t)rhs + carry, (int32_t)(int8_t)res);
+    return res;
+}
+
+static uint8_t Fy_VM_sbb8(Fy_VM *vm, uint8_t lhs, uint8_t rhs) {
+    uint8_t borrow = vm->flags & FY_FLAGS_CARRY ? 1 : 0;
+    uint8_t res = lhs - rhs - borrow;
+    Fy_VM_setCarryFlag(vm, (uint32_t)lhs - (uint32_t)rhs - borrow, (uint32_t)res);
+    Fy_VM_setOverflowFlag(vm, (int32_t)(int8_t)lhs - (int8_t)rhs - borrow, (int32_t)(int8_t)res);
+    return res;
+}
+
 /* Set the ip register to the given address relative to the code's start point in memory */
 void Fy_VM_setIpToRelAddress(Fy_VM *vm, uint16_t address) {
     vm->reg_ip = vm->code_offset + address;
@@ -819,7 +1349,8 @@ uint16_t Fy_VM_popFromStack(Fy_VM *vm) {
     return value;
 }
 
-uint16_t Fy_VM_calculateAddress(Fy_VM *vm, uint16_t *variable_off_ptr, uint16_t amount_bp, uint16_t amount_bx, uint16_t additional) {
+uint16_t Fy_VM_calculateAddress(Fy_VM *vm, uint16_t *variable_off_ptr, uint16_t amount_bp, uint16_t amount_bx,
+                                uint16_t amount_si, uint16_t amount_di, uint16_t additional) {
     uint16_t address = 0;
     uint16_t bx_value;
 
@@ -828,6 +1359,8 @@ uint16_t Fy_VM_calculateAddress(Fy_VM *vm, uint16_t *variable_off_ptr, uint16_t
     address += variable_off_ptr ? *(int16_t*)variable_off_ptr + vm->data_offset : 0;
     address += *(int16_t*)&amount_bp * vm->reg_bp;
     address += *(int16_t*)&amount_bx * bx_value;
+    address += *(int16_t*)&amount_si * vm->reg_si;
+    address += *(int16_t*)&amount_di * vm->reg_di;
     address += *(int16_t*)&additional;
     return address;
 }
@@ -838,6 +1371,8 @@ uint16_t Fy_VM_readMemoryParam(Fy_VM *vm, uint16_t address, uint16_t *out) {
     uint16_t variable = 0;
     uint16_t amount_bp = 0;
     uint16_t amount_bx = 0;
+    uint16_t amount_si = 0;
+    uint16_t amount_di = 0;
     uint16_t mem_addr = 0;
     uint16_t full_addr;
     uint16_t size = 1;
@@ -854,12 +1389,21 @@ uint16_t Fy_VM_readMemoryParam(Fy_VM *vm, uint16_t address, uint16_t *out) {
         amount_bx = Fy_VM_getMem16(vm, address + size);
         size += 2;
     }
+    if (mapping & FY_INLINEVAL_MAPPING_HASSI) {
+        amount_si = Fy_VM_getMem16(vm, address + size);
+        size += 2;
+    }
+    if (mapping & FY_INLINEVAL_MAPPING_HASDI) {
+        amount_di = Fy_VM_getMem16(vm, address + size);
+        size += 2;
+    }
     if (mapping & FY_INLINEVAL_MAPPING_HASNUM) {
         mem_addr = Fy_VM_getMem16(vm, address + size);
         size += 2;
     }
 
-    full_addr = Fy_VM_calculateAddress(vm, mapping & FY_INLINEVAL_MAPPING_HASVAR ? &variable : NULL, amount_bp, amount_bx, mem_addr);
+    full_addr = Fy_VM_calculateAddress(vm, mapping & FY_INLINEVAL_MAPPING_HASVAR ? &variable : NULL, amount_bp, amount_bx,
+                                       amount_si, amount_di, mem_addr);
     *out = full_addr;
     return size;
 }
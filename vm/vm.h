@@ -7,13 +7,24 @@
 #include <SDL2/SDL.h>
 
 #include "timecontrol.h"
+#include "random.h"
+#include "output.h"
+#include "hashtable.h"
+#include "heap.h"
+#include "screen.h"
 
 #define FY_FLAGS_ZERO (1 << 0)
 #define FY_FLAGS_SIGN (1 << 1)
 #define FY_FLAGS_OVERFLOW (1 << 2)
 #define FY_FLAGS_CARRY (1 << 3)
 
+/* Maximum amount of milliseconds we block in SDL before checking for exit signals */
+#define FY_VM_WAIT_SLICE 100
+/* Instructions run between reads of the clock while a timer handler is installed */
+#define FY_VM_TIMER_CHECK_INTERVAL 1024
+
 typedef struct Fy_VM Fy_VM;
+typedef struct Fy_VMOptions Fy_VMOptions;
 typedef enum Fy_RuntimeError Fy_RuntimeError;
 typedef struct Fy_BytecodeFileStream Fy_BytecodeFileStream;
 
@@ -32,7 +43,20 @@ enum Fy_RuntimeError {
     Fy_RuntimeError_InterruptError,
     Fy_RuntimeError_PixelNotInScreen,
     Fy_RuntimeError_DivisionByZero,
-    Fy_RuntimeError_DivisionResultTooBig
+    Fy_RuntimeError_DivisionResultTooBig,
+    Fy_RuntimeError_FloatRegNotFound
+};
+
+/* Options given to the virtual machine from the command line */
+struct Fy_VMOptions {
+    /* Use `seed` for the random generator instead of the time */
+    bool has_seed;
+    uint64_t seed;
+    Fy_OutputFlushPolicy flush_policy;
+    /* Write console output from a separate thread */
+    bool output_thread;
+    /* Window, frame dump and capture settings */
+    Fy_ScreenOptions screen;
 };
 
 struct Fy_VM {
@@ -54,6 +78,12 @@ struct Fy_VM {
     uint16_t reg_ip;
     uint16_t reg_sp;
     uint16_t reg_bp;
+    uint16_t reg_si;
+    uint16_t reg_di;
+    /* r8 to r15 */
+    uint16_t reg_r[8];
+    /* f0 to f7 */
+    float reg_f[8];
     /* Is running? */
     bool running;
     /* Is there an error? combined with `running` */
@@ -66,44 +96,84 @@ struct Fy_VM {
         bool has_key;
         SDL_Scancode key_scancode;
     } keyboard;
+    /* Guest interrupt handlers, stored as code-relative addresses */
+    struct {
+        /* Set while a handler runs, until it returns with iret */
+        bool in_handler;
+        bool has_timer_handler;
+        uint16_t timer_handler;
+        uint16_t timer_period;
+        uint64_t timer_deadline;
+        /* Instructions left until the clock is read again */
+        uint32_t timer_countdown;
+        bool has_keyboard_handler;
+        uint16_t keyboard_handler;
+    } irq;
     /* Random related stuff */
-    uint16_t random_seed;
+    Fy_Random random;
+    /* Buffered console output */
+    Fy_Output output;
+    /* Hash tables created by the program */
+    Fy_Hashtables hashtables;
+    /* Allocator for the memory above the stack */
+    Fy_Heap heap;
 
     /* Graphics-related */
-    SDL_Window *window;
-    SDL_Surface *surface;
+    Fy_Screen screen;
 };
 
 bool Fy_OpenBytecodeFile(char *filename, Fy_BytecodeFileStream *out);
 void Fy_BytecodeFileStream_Destruct(Fy_BytecodeFileStream *bc);
 
-void Fy_VM_Init(Fy_BytecodeFileStream *bc, Fy_VM *out);
+void Fy_VM_Init(Fy_BytecodeFileStream *bc, Fy_VMOptions *options, Fy_VM *out);
 void Fy_VM_Destruct(Fy_VM *vm);
-uint16_t Fy_VM_generateRandom(Fy_VM *vm);
 uint8_t Fy_VM_getMem8(Fy_VM *vm, uint16_t address);
 uint16_t Fy_VM_getMem16(Fy_VM *vm, uint16_t address);
 void Fy_VM_setMem8(Fy_VM *vm, uint16_t address, uint8_t value);
+void Fy_VM_markMemWritten(Fy_VM *vm, uint16_t address, uint32_t length);
 void Fy_VM_setMem16(Fy_VM *vm, uint16_t address, uint16_t value);
+void Fy_VM_readMemInto(Fy_VM *vm, uint16_t address, uint8_t *out, uint32_t length);
+void Fy_VM_writeMemFrom(Fy_VM *vm, uint16_t address, const uint8_t *data, uint32_t length);
+void Fy_VM_copyMem(Fy_VM *vm, uint16_t dest, uint16_t src, uint32_t length);
+void Fy_VM_fillMem8(Fy_VM *vm, uint16_t dest, uint8_t value, uint32_t length);
+void Fy_VM_fillMem16(Fy_VM *vm, uint16_t dest, uint16_t value, uint32_t count);
+uint32_t Fy_VM_compareMem(Fy_VM *vm, uint16_t address1, uint16_t address2, uint32_t length);
+bool Fy_VM_findByte(Fy_VM *vm, uint16_t address, uint8_t value, uint32_t length, uint16_t *out);
+bool Fy_VM_getStringLength(Fy_VM *vm, uint16_t address, uint16_t *out);
+void Fy_VM_compare16(Fy_VM *vm, uint16_t lhs, uint16_t rhs);
+void Fy_VM_compare8(Fy_VM *vm, uint8_t lhs, uint8_t rhs);
 bool Fy_VM_getReg16(Fy_VM *vm, uint8_t reg, uint16_t *out);
 bool Fy_VM_setReg16(Fy_VM *vm, uint8_t reg, uint16_t value);
 bool Fy_VM_getReg8(Fy_VM *vm, uint8_t reg, uint8_t *out);
 bool Fy_VM_setReg8(Fy_VM *vm, uint8_t reg, uint8_t value);
+bool Fy_VM_getRegFloat(Fy_VM *vm, uint8_t reg, float *out);
+bool Fy_VM_setRegFloat(Fy_VM *vm, uint8_t reg, float value);
 bool Fy_VM_isWritableReg16(Fy_VM *vm, uint8_t reg);
 bool Fy_VM_isWritableReg8(Fy_VM *vm, uint8_t reg);
 bool Fy_VM_runBinaryOperatorOnReg16(Fy_VM *vm, Fy_BinaryOperator operator, uint8_t reg_id, uint16_t value);
 bool Fy_VM_runBinaryOperatorOnReg8(Fy_VM *vm, Fy_BinaryOperator operator, uint8_t reg_id, uint8_t value);
 bool Fy_VM_runBinaryOperatorOnMem16(Fy_VM *vm, Fy_BinaryOperator operator, uint16_t address, uint16_t value);
 bool Fy_VM_runBinaryOperatorOnMem8(Fy_VM *vm, Fy_BinaryOperator operator, uint16_t address, uint8_t value);
+bool Fy_VM_runBinaryOperator3OnReg16(Fy_VM *vm, Fy_BinaryOperator operator, uint8_t reg_id, uint16_t lhs, uint16_t rhs);
+bool Fy_VM_runBinaryOperator3OnReg8(Fy_VM *vm, Fy_BinaryOperator operator, uint8_t reg_id, uint8_t lhs, uint8_t rhs);
+bool Fy_VM_runOperator32(Fy_VM *vm, Fy_BinaryOperator operator, uint32_t value);
+bool Fy_VM_isConditionMet(Fy_VM *vm, Fy_Condition condition);
+bool Fy_VM_runFpuOperator(Fy_VM *vm, Fy_FpuOperator operator, uint8_t reg_id, float value);
 bool Fy_VM_runUnaryOperatorOnReg16(Fy_VM *vm, Fy_UnaryOperator operator, uint8_t reg_id);
 bool Fy_VM_runUnaryOperatorOnMem16(Fy_VM *vm, Fy_UnaryOperator operator, uint16_t address);
 bool Fy_VM_runUnaryOperatorOnReg8(Fy_VM *vm, Fy_UnaryOperator operator, uint8_t reg_id);
 bool Fy_VM_runUnaryOperatorOnMem8(Fy_VM *vm, Fy_UnaryOperator operator, uint16_t address);
 void Fy_VM_runtimeError(Fy_VM *vm, Fy_RuntimeError err, char *additional, ...);
 int Fy_VM_runAll(Fy_VM *vm);
+void Fy_VM_sleep(Fy_VM *vm, uint16_t milliseconds);
+void Fy_VM_waitForInput(Fy_VM *vm, uint16_t timeout);
+void Fy_VM_waitForInterrupt(Fy_VM *vm);
+void Fy_VM_returnFromInterrupt(Fy_VM *vm);
 void Fy_VM_setIpToRelAddress(Fy_VM *vm, uint16_t address);
 void Fy_VM_pushToStack(Fy_VM *vm, uint16_t value);
 uint16_t Fy_VM_popFromStack(Fy_VM *vm);
-uint16_t Fy_VM_calculateAddress(Fy_VM *vm, uint16_t *variable_off_ptr, uint16_t amount_bp, uint16_t amount_bx, uint16_t additional);
+uint16_t Fy_VM_calculateAddress(Fy_VM *vm, uint16_t *variable_off_ptr, uint16_t amount_bp, uint16_t amount_bx,
+                                uint16_t amount_si, uint16_t amount_di, uint16_t additional);
 uint16_t Fy_VM_readMemoryParam(Fy_VM *vm, uint16_t address, uint16_t *out);
 
 #endif /* FY_VM_H */